@@ -16,6 +16,7 @@
 
 #include "au/apply_rational_magnitude_to_integral.hh"
 #include "au/magnitude.hh"
+#include "au/rep.hh"
 
 namespace au {
 namespace detail {
@@ -42,6 +43,48 @@ constexpr ApplyAs categorize_magnitude(Magnitude<BPs...>) {
                                                 : ApplyAs::IRRATIONAL_MULTIPLY;
 }
 
+// The arithmetic for applying the magnitude `Mag` to a value of type `T`, in each category.  For
+// a complex `T`, we multiply (or divide) by a value of its real part type.
+//
+// These are free functions, rather than members of `ApplyMagnitudeImpl`, so that applying
+// a magnitude doesn't also instantiate its overflow and truncation checks.  Debug info describes
+// every member of every class it mentions, so this keeps each conversion's debug info small.
+template <ApplyAs Category, bool is_T_integral>
+struct ApplyAsTag {};
+
+// Multiplying by an integer, for any type T.
+template <typename Mag, typename T, bool is_T_integral>
+constexpr T apply_magnitude_as(const T &x, ApplyAsTag<ApplyAs::INTEGER_MULTIPLY, is_T_integral>) {
+    return x * get_value<RealPartT<T>>(Mag{});
+}
+
+// Dividing by an integer, for any type T.
+template <typename Mag, typename T, bool is_T_integral>
+constexpr T apply_magnitude_as(const T &x, ApplyAsTag<ApplyAs::INTEGER_DIVIDE, is_T_integral>) {
+    return x / get_value<RealPartT<T>>(MagInverseT<Mag>{});
+}
+
+// Applying a (non-integer, non-inverse-integer) rational, for any integral type T.
+template <typename Mag, typename T>
+constexpr T apply_magnitude_as(const T &x, ApplyAsTag<ApplyAs::RATIONAL_MULTIPLY, true>) {
+    using P = PromotedType<T>;
+    return static_cast<T>(x * get_value<P>(numerator(Mag{})) / get_value<P>(denominator(Mag{})));
+}
+
+// Applying a (non-integer, non-inverse-integer) rational, for any non-integral type T.
+template <typename Mag, typename T>
+constexpr T apply_magnitude_as(const T &x, ApplyAsTag<ApplyAs::RATIONAL_MULTIPLY, false>) {
+    return x * get_value<RealPartT<T>>(Mag{});
+}
+
+// Applying an irrational for any type T (although only non-integral T makes sense).
+template <typename Mag, typename T, bool is_T_integral>
+constexpr T apply_magnitude_as(const T &x,
+                               ApplyAsTag<ApplyAs::IRRATIONAL_MULTIPLY, is_T_integral>) {
+    static_assert(!std::is_integral<T>::value, "Cannot apply irrational magnitude to integer type");
+    return x * get_value<RealPartT<T>>(Mag{});
+}
+
 template <typename Mag, ApplyAs Category, typename T, bool is_T_integral>
 struct ApplyMagnitudeImpl;
 
@@ -103,7 +146,9 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::INTEGER_MULTIPLY, T, is_T_integral> {
     static_assert(is_T_integral == std::is_integral<T>::value,
                   "Mismatched instantiation (should never be done manually)");
 
-    constexpr T operator()(const T &x) { return x * get_value<T>(Mag{}); }
+    constexpr T operator()(const T &x) {
+        return apply_magnitude_as<Mag>(x, ApplyAsTag<ApplyAs::INTEGER_MULTIPLY, is_T_integral>{});
+    }
 
     static constexpr bool would_overflow(const T &x) {
         constexpr auto mag_value_result = get_value_result<T>(Mag{});
@@ -122,7 +167,9 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::INTEGER_DIVIDE, T, is_T_integral> {
     static_assert(is_T_integral == std::is_integral<T>::value,
                   "Mismatched instantiation (should never be done manually)");
 
-    constexpr T operator()(const T &x) { return x / get_value<T>(MagInverseT<Mag>{}); }
+    constexpr T operator()(const T &x) {
+        return apply_magnitude_as<Mag>(x, ApplyAsTag<ApplyAs::INTEGER_DIVIDE, is_T_integral>{});
+    }
 
     static constexpr bool would_overflow(const T &) { return false; }
 
@@ -164,9 +211,7 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::RATIONAL_MULTIPLY, T, true> {
                   "Mismatched instantiation (should never be done manually)");
 
     constexpr T operator()(const T &x) {
-        using P = PromotedType<T>;
-        return static_cast<T>(x * get_value<P>(numerator(Mag{})) /
-                              get_value<P>(denominator(Mag{})));
+        return apply_magnitude_as<Mag>(x, ApplyAsTag<ApplyAs::RATIONAL_MULTIPLY, true>{});
     }
 
     static constexpr bool would_overflow(const T &x) {
@@ -188,7 +233,9 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::RATIONAL_MULTIPLY, T, false> {
     static_assert(!std::is_integral<T>::value,
                   "Mismatched instantiation (should never be done manually)");
 
-    constexpr T operator()(const T &x) { return x * get_value<T>(Mag{}); }
+    constexpr T operator()(const T &x) {
+        return apply_magnitude_as<Mag>(x, ApplyAsTag<ApplyAs::RATIONAL_MULTIPLY, false>{});
+    }
 
     static constexpr bool would_overflow(const T &x) {
         constexpr auto mag_value_result = get_value_result<T>(Mag{});
@@ -209,7 +256,10 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::IRRATIONAL_MULTIPLY, T, is_T_integral> {
     static_assert(is_T_integral == std::is_integral<T>::value,
                   "Mismatched instantiation (should never be done manually)");
 
-    constexpr T operator()(const T &x) { return x * get_value<T>(Mag{}); }
+    constexpr T operator()(const T &x) {
+        return apply_magnitude_as<Mag>(x,
+                                       ApplyAsTag<ApplyAs::IRRATIONAL_MULTIPLY, is_T_integral>{});
+    }
 
     static constexpr bool would_overflow(const T &x) {
         constexpr auto mag_value_result = get_value_result<T>(Mag{});
@@ -220,20 +270,45 @@ struct ApplyMagnitudeImpl<Mag, ApplyAs::IRRATIONAL_MULTIPLY, T, is_T_integral> {
     static constexpr bool would_truncate(const T &) { return false; }
 };
 
+// Applying any magnitude to a complex type T, whose real and imaginary parts must both be safe.
+template <typename Mag, typename T>
+struct ApplyMagnitudeToComplex {
+    using PartImpl = ApplyMagnitudeImpl<Mag,
+                                        categorize_magnitude(Mag{}),
+                                        RealPartT<T>,
+                                        std::is_integral<RealPartT<T>>::value>;
+
+    constexpr T operator()(const T &x) {
+        return apply_magnitude_as<Mag>(x, ApplyAsTag<categorize_magnitude(Mag{}), false>{});
+    }
+
+    static constexpr bool would_overflow(const T &x) {
+        return PartImpl::would_overflow(x.real()) || PartImpl::would_overflow(x.imag());
+    }
+
+    static constexpr bool would_truncate(const T &x) {
+        return PartImpl::would_truncate(x.real()) || PartImpl::would_truncate(x.imag());
+    }
+};
+
 template <typename T, typename MagT>
 struct ApplyMagnitudeType;
 template <typename T, typename MagT>
 using ApplyMagnitudeT = typename ApplyMagnitudeType<T, MagT>::type;
 template <typename T, typename... BPs>
 struct ApplyMagnitudeType<T, Magnitude<BPs...>>
-    : stdx::type_identity<ApplyMagnitudeImpl<Magnitude<BPs...>,
-                                             categorize_magnitude(Magnitude<BPs...>{}),
-                                             T,
-                                             std::is_integral<T>::value>> {};
+    : std::conditional<IsComplexRep<T>::value,
+                       ApplyMagnitudeToComplex<Magnitude<BPs...>, T>,
+                       ApplyMagnitudeImpl<Magnitude<BPs...>,
+                                          categorize_magnitude(Magnitude<BPs...>{}),
+                                          T,
+                                          std::is_integral<T>::value>> {};
 
 template <typename T, typename... BPs>
 constexpr T apply_magnitude(const T &x, Magnitude<BPs...>) {
-    return ApplyMagnitudeT<T, Magnitude<BPs...>>{}(x);
+    using Mag = Magnitude<BPs...>;
+    return apply_magnitude_as<Mag>(
+        x, ApplyAsTag<categorize_magnitude(Mag{}), std::is_integral<T>::value>{});
 }
 
 }  // namespace detail
@@ -14,7 +14,10 @@
 
 #pragma once
 
-#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 #include "au/magnitude.hh"
 #include "au/stdx/utility.hh"
@@ -0,0 +1,77 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Unit conversions in every category of `au/apply_magnitude.hh`.
+//
+// Each `au_<name>` function must compile to the same machine code as `raw_<name>`.  See
+// `check_assembly_equivalence.py` for details.
+
+#include <cstdint>
+
+#include "au/prefix.hh"
+#include "au/quantity.hh"
+#include "au/units/degrees.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+
+using namespace au;
+
+extern "C" {
+
+// INTEGER_MULTIPLY
+std::int32_t raw_feet_to_inches_i32(std::int32_t x) { return x * 12; }
+std::int32_t au_feet_to_inches_i32(std::int32_t x) { return feet(x).in(inches); }
+
+double raw_feet_to_inches_f64(double x) { return x * 12.0; }
+double au_feet_to_inches_f64(double x) { return feet(x).in(inches); }
+
+// INTEGER_DIVIDE
+std::int32_t raw_inches_to_feet_i32(std::int32_t x) { return x / 12; }
+std::int32_t au_inches_to_feet_i32(std::int32_t x) { return inches(x).coerce_in(feet); }
+
+std::uint64_t raw_meters_to_kilometers_u64(std::uint64_t x) { return x / 1000u; }
+std::uint64_t au_meters_to_kilometers_u64(std::uint64_t x) {
+    return meters(x).coerce_in(kilo(meters));
+}
+
+double raw_meters_to_kilometers_f64(double x) { return x / 1000.0; }
+double au_meters_to_kilometers_f64(double x) { return meters(x).in(kilo(meters)); }
+
+// RATIONAL_MULTIPLY
+std::int64_t raw_inches_to_centimeters_i64(std::int64_t x) { return x * 127 / 50; }
+std::int64_t au_inches_to_centimeters_i64(std::int64_t x) {
+    return inches(x).coerce_in(centi(meters));
+}
+
+double raw_inches_to_centimeters_f64(double x) { return x * 2.54; }
+double au_inches_to_centimeters_f64(double x) { return inches(x).in(centi(meters)); }
+
+// IRRATIONAL_MULTIPLY
+double raw_degrees_to_radians_f64(double x) { return x * 0.017453292519943295; }
+double au_degrees_to_radians_f64(double x) { return degrees(x).in(radians); }
+
+float raw_degrees_to_radians_f32(float x) { return x * 0.017453292f; }
+float au_degrees_to_radians_f32(float x) { return degrees(x).in(radians); }
+
+// Explicit-rep conversion.
+std::int32_t raw_meters_f64_to_millimeters_i32(double x) {
+    return static_cast<std::int32_t>(x * 1000.0);
+}
+std::int32_t au_meters_f64_to_millimeters_i32(double x) {
+    return meters(x).in<std::int32_t>(milli(meters));
+}
+
+}  // extern "C"
@@ -0,0 +1,58 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests that Au code compiles to the same machine code as the equivalent raw arithmetic."""
+
+load("@rules_python//python:defs.bzl", "py_test")
+
+def assembly_equivalence_test(name, src, max_extra_instructions = 0, **kwargs):
+    """Compile `src` to assembly at `-O2`, and check each `au_<name>` against `raw_<name>`.
+
+    The assembly comes from whichever C++ toolchain is selected (see `--config` in `.bazelrc`), so
+    running this test under each supported config checks each toolchain.
+
+    Args:
+        name: The name of the test.
+        src: A C++ file defining pairs of `extern "C"` functions, `raw_<name>` and `au_<name>`.
+        max_extra_instructions: How many more instructions an Au function may have than its raw
+            counterpart, when it is not identical.
+        **kwargs: Passed through to the `py_test`.
+    """
+    asm = name + "_asm"
+    native.genrule(
+        name = asm,
+        srcs = [
+            src,
+            "//au:headers",
+        ],
+        outs = [name + ".s"],
+        cmd = "$(CC) $(CC_FLAGS) -std=c++14 -O2 -S -I. -o $@ $(location {})".format(src),
+        toolchains = [
+            "@bazel_tools//tools/cpp:cc_flags",
+            "@bazel_tools//tools/cpp:current_cc_toolchain",
+        ],
+        tools = ["@bazel_tools//tools/cpp:current_cc_toolchain"],
+    )
+
+    py_test(
+        name = name,
+        srcs = ["//au/assembly:check_assembly_equivalence.py"],
+        main = "check_assembly_equivalence.py",
+        args = [
+            "--max-extra-instructions={}".format(max_extra_instructions),
+            "$(location :{})".format(asm),
+        ],
+        data = [":" + asm],
+        **kwargs
+    )
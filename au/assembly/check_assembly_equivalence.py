@@ -0,0 +1,363 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Check that Au code compiles to the same machine code as raw arithmetic.
+
+Each input is an assembly file (GNU syntax, as produced by `-S`) of a translation unit which defines
+pairs of `extern "C"` functions: `raw_<name>`, which does some computation on raw numbers, and
+`au_<name>`, which does the same computation using Au.  For every pair, we check that the Au version
+is identical to the raw version, up to the names of local labels.  If it's not, we fail, unless
+`--max-extra-instructions` is positive, and the Au version has more instructions than the raw
+version, but no more than that many more.  (Code which is different, but no longer, is a real
+difference, which an instruction budget can't excuse.)
+
+References to constants (such as the conversion factor for a floating point multiplication) are
+replaced by the constants' values, so that the comparison is sensitive to the values themselves.
+
+Before comparing, we also put each body in a canonical form, so that choices which the compiler
+makes arbitrarily don't count as differences.  These are the order of the operands of an x86
+register-register compare (along with the condition of the `set<cc>` or `j<cc>` which reads it),
+and the order of a run of independent multiplications.
+"""
+
+import argparse
+import re
+import sys
+
+RAW_PREFIX = "raw_"
+AU_PREFIX = "au_"
+
+LABEL = re.compile(r"^([A-Za-z_.$][\w.$@]*):")
+LOCAL_SYMBOL = re.compile(r"\.?L[\w.$]+")
+ALIAS = re.compile(r"^\.set\s+([\w.$]+)\s*,\s*([\w.$]+)$|^([\w.$]+)\s*=\s*([\w.$]+)$")
+DATA_DIRECTIVES = {
+    ".2byte",
+    ".4byte",
+    ".8byte",
+    ".ascii",
+    ".asciz",
+    ".byte",
+    ".double",
+    ".float",
+    ".hword",
+    ".int",
+    ".long",
+    ".quad",
+    ".short",
+    ".single",
+    ".string",
+    ".value",
+    ".word",
+    ".zero",
+}
+FUNCTION_END_DIRECTIVES = (".cfi_endproc", ".size")
+
+# Comments: `//` anywhere (AArch64), or `#` (x86) at the start of a line, or followed by whitespace,
+# another `#`, or the end of the line.  A `#` followed by anything else is an AArch64 immediate,
+# such as `#16`, `#-1`, or `#:lo12:sym`, and is part of the instruction.
+COMMENT = re.compile(r"//|^\s*#|\s#(?=[\s#]|$)")
+
+
+def strip_comment(line):
+    comment = COMMENT.search(line)
+    if comment:
+        line = line[: comment.start()]
+    return " ".join(line.split())
+
+
+def is_function_of_interest(name):
+    return name.startswith(RAW_PREFIX) or name.startswith(AU_PREFIX)
+
+
+class Assembly:
+    """The parts of an assembly file we need: function bodies, constant data, and aliases."""
+
+    def __init__(self, text):
+        # Map from function name to its body: a list of instruction lines and local label lines.
+        self.functions = {}
+
+        # Map from local data label to the tuple of data directives which follow it.
+        self.data = {}
+
+        # Map from alias name to the name of the symbol it refers to.
+        self.aliases = {}
+
+        current_function = None
+        current_data = None
+        for line in (strip_comment(l) for l in text.splitlines()):
+            if not line:
+                continue
+
+            alias = ALIAS.match(line)
+            if alias:
+                name, target = alias.group(1) or alias.group(3), alias.group(2) or alias.group(4)
+                self.aliases[name] = target
+                continue
+
+            label = LABEL.match(line)
+            if label:
+                name = label.group(1)
+                current_data = None
+                if current_function and name.startswith(".L"):
+                    if name.startswith(".Lfunc_end"):
+                        current_function = None
+                    else:
+                        self.functions[current_function].append(name + ":")
+                    continue
+                current_function = None
+                if is_function_of_interest(name):
+                    current_function = name
+                    self.functions[name] = []
+                elif LOCAL_SYMBOL.fullmatch(name):
+                    current_data = name
+                    self.data[name] = []
+                continue
+
+            if line.startswith("."):
+                directive = line.split()[0]
+                if current_function and directive.startswith(FUNCTION_END_DIRECTIVES):
+                    current_function = None
+                elif current_data and directive in DATA_DIRECTIVES:
+                    self.data[current_data].append(line)
+                elif current_data and not directive.startswith((".p2align", ".align")):
+                    current_data = None
+                continue
+
+            if current_function:
+                self.functions[current_function].append(line)
+
+    def resolve(self, name):
+        """Follow aliases to the symbol which actually holds the code."""
+        seen = set()
+        while name in self.aliases and name not in seen:
+            seen.add(name)
+            name = self.aliases[name]
+        return name
+
+    def normalized_body(self, name):
+        """The body of function `name`, with local labels renamed and constants made explicit."""
+        body = self.functions.get(self.resolve(name), [])
+        referenced = set()
+        for line in body:
+            if not line.endswith(":"):
+                referenced.update(LOCAL_SYMBOL.findall(line))
+
+        label_names = {}
+
+        def replace(match):
+            symbol = match.group(0)
+            if symbol in self.data:
+                return "<{}>".format("; ".join(self.data[symbol]))
+            return label_names.setdefault(symbol, "<label{}>".format(len(label_names)))
+
+        result = []
+        for line in body:
+            if line.endswith(":") and line[:-1] not in referenced:
+                continue
+            result.append(LOCAL_SYMBOL.sub(replace, line))
+        return result
+
+
+def num_instructions(body):
+    return sum(1 for line in body if not line.endswith(":"))
+
+
+# The x86 condition code which means the same thing after swapping the operands of the comparison.
+SWAPPED_CONDITION = {
+    "e": "e",
+    "ne": "ne",
+    "z": "z",
+    "nz": "nz",
+    "a": "b",
+    "ae": "be",
+    "b": "a",
+    "be": "ae",
+    "g": "l",
+    "ge": "le",
+    "l": "g",
+    "le": "ge",
+    "na": "nb",
+    "nae": "nbe",
+    "nb": "na",
+    "nbe": "nae",
+    "ng": "nl",
+    "nge": "nle",
+    "nl": "ng",
+    "nle": "nge",
+}
+REGISTER_COMPARE = re.compile(r"^(cmp[bwlq]?) (%\w+), (%\w+)$")
+CONDITION_USE = re.compile(r"^(set|j)([a-z]+)( .*)$")
+OTHER_FLAG_READER = re.compile(r"^(adc|cmov|j|rcl|rcr|sbb|set)")
+MULTIPLY = re.compile(r"^v?f?mul\w*\s")
+
+
+def split_operands(instruction):
+    """The operands of `instruction`, split on the commas which aren't inside parentheses."""
+    parts = instruction.split(None, 1)
+    if len(parts) < 2:
+        return []
+    operands, depth, current = [], 0, ""
+    for c in parts[1]:
+        depth += {"(": 1, ")": -1}.get(c, 0)
+        if c == "," and depth == 0:
+            operands.append(current.strip())
+            current = ""
+        else:
+            current += c
+    return operands + [current.strip()]
+
+
+def destination(instruction):
+    """The operand `instruction` writes: last in AT&T syntax (x86), and first otherwise."""
+    operands = split_operands(instruction)
+    return operands[-1] if "%" in instruction else operands[0]
+
+
+def are_independent(instructions):
+    """Whether no instruction in the list reads or writes any other's destination register."""
+    destinations = [destination(i) for i in instructions]
+    if len(set(destinations)) != len(destinations):
+        return False
+    return all(
+        not re.search(r"(?<![\w%]){}(?!\w)".format(re.escape(d)), other)
+        for i, d in enumerate(destinations)
+        for j, other in enumerate(instructions)
+        if i != j
+    )
+
+
+def canonical_form(body):
+    """`body`, with commuted comparisons and reordered independent multiplications made uniform."""
+    result = list(body)
+
+    # Register-register comparisons: sort the operands, and adjust the conditions which follow.
+    for i, line in enumerate(result):
+        compare = REGISTER_COMPARE.match(line)
+        if not compare or compare.group(2) <= compare.group(3):
+            continue
+        uses = []
+        for j in range(i + 1, len(result)):
+            use = CONDITION_USE.match(result[j])
+            if not use or use.group(2) not in SWAPPED_CONDITION:
+                break
+            uses.append(j)
+        after = uses[-1] + 1 if uses else None
+        if not uses or (after < len(result) and OTHER_FLAG_READER.match(result[after])):
+            continue
+        result[i] = "{} {}, {}".format(compare.group(1), compare.group(3), compare.group(2))
+        for j in uses:
+            use = CONDITION_USE.match(result[j])
+            result[j] = use.group(1) + SWAPPED_CONDITION[use.group(2)] + use.group(3)
+
+    # Runs of consecutive independent multiplications: sort them.
+    i = 0
+    while i < len(result):
+        j = i
+        while j < len(result) and MULTIPLY.match(result[j]):
+            j += 1
+        if j - i > 1 and are_independent(result[i:j]):
+            result[i:j] = sorted(result[i:j])
+        i = max(j, i + 1)
+    return result
+
+
+def is_tail_call_to(body, target):
+    """Whether `body` is just a jump to `target` (as identical-code-folding may produce)."""
+    instructions = [line for line in body if not line.endswith(":")]
+    return len(instructions) == 1 and re.fullmatch(
+        r"(jmp|b)\s+{}(@PLT)?".format(re.escape(target)), instructions[0]
+    )
+
+
+def check_pair(assembly, name, max_extra_instructions):
+    """Return a list of error messages (empty if the pair passes)."""
+    raw_name, au_name = RAW_PREFIX + name, AU_PREFIX + name
+    if assembly.resolve(au_name) == assembly.resolve(raw_name):
+        return []
+
+    raw, au = assembly.normalized_body(raw_name), assembly.normalized_body(au_name)
+    if not raw:
+        return ["{}: no code found".format(raw_name)]
+    if not au:
+        return ["{}: no code found".format(au_name)]
+    if canonical_form(au) == canonical_form(raw) or is_tail_call_to(au, raw_name):
+        return []
+
+    extra = num_instructions(au) - num_instructions(raw)
+    if 0 < extra <= max_extra_instructions:
+        print("{}: not identical, but within budget ({} extra instructions)".format(name, extra))
+        return []
+
+    return [
+        "\n".join(
+            [
+                "{}: not identical ({} extra instructions; budget: {})".format(
+                    name, extra, max_extra_instructions
+                ),
+                "  {}:".format(raw_name),
+            ]
+            + ["    " + line for line in raw]
+            + ["  {}:".format(au_name)]
+            + ["    " + line for line in au]
+        )
+    ]
+
+
+def check_file(path, max_extra_instructions):
+    with open(path) as f:
+        assembly = Assembly(f.read())
+
+    names = set(assembly.functions) | set(assembly.aliases)
+    au_names = sorted(n[len(AU_PREFIX) :] for n in names if n.startswith(AU_PREFIX))
+    raw_names = sorted(n[len(RAW_PREFIX) :] for n in names if n.startswith(RAW_PREFIX))
+    if not au_names:
+        return ["{}: found no `{}` functions to check".format(path, AU_PREFIX)]
+
+    errors = [
+        "{}: `{}{}` has no matching `{}{}`".format(path, prefix, n, other, n)
+        for prefix, other, mine, theirs in [
+            (AU_PREFIX, RAW_PREFIX, au_names, raw_names),
+            (RAW_PREFIX, AU_PREFIX, raw_names, au_names),
+        ]
+        for n in mine
+        if n not in theirs
+    ]
+    pairs = [n for n in au_names if n in raw_names]
+    for name in pairs:
+        errors += check_pair(assembly, name, max_extra_instructions)
+    print("{}: checked {} pairs".format(path, len(pairs)))
+    return errors
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("assembly_files", nargs="+")
+    parser.add_argument(
+        "--max-extra-instructions",
+        type=int,
+        default=0,
+        help="How many more instructions the Au version may have, if it is not identical",
+    )
+    args = parser.parse_args(argv)
+
+    errors = []
+    for path in args.assembly_files:
+        errors += check_file(path, args.max_extra_instructions)
+    for error in errors:
+        print(error, file=sys.stderr)
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,100 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import unittest
+
+from check_assembly_equivalence import Assembly, check_pair, strip_comment
+
+
+def assembly(raw_body, au_body):
+    lines = ["raw_f:"] + raw_body + [".cfi_endproc", "au_f:"] + au_body + [".cfi_endproc"]
+    return Assembly("\n".join(lines))
+
+
+class StripCommentTest(unittest.TestCase):
+    def test_strips_x86_comments(self):
+        self.assertEqual(strip_comment("    movl %edi, %eax  # kill: def $eax"), "movl %edi, %eax")
+        self.assertEqual(strip_comment("# %bb.0:"), "")
+        self.assertEqual(strip_comment("#APP"), "")
+        self.assertEqual(strip_comment("    addl $1, %eax    ## InlineAsm"), "addl $1, %eax")
+
+    def test_strips_aarch64_comments(self):
+        self.assertEqual(strip_comment("    mov w0, w1  // =0x1"), "mov w0, w1")
+
+    def test_keeps_aarch64_immediates(self):
+        self.assertEqual(strip_comment("    add w0, w0, #16"), "add w0, w0, #16")
+        self.assertEqual(strip_comment("    mov x0, #-1"), "mov x0, #-1")
+        self.assertEqual(
+            strip_comment("    add x0, x0, #:lo12:.LCPI0_0"), "add x0, x0, #:lo12:.LCPI0_0"
+        )
+        self.assertEqual(strip_comment("    lsl w0, w0, #2 // x4"), "lsl w0, w0, #2")
+
+
+class CheckPairTest(unittest.TestCase):
+    def test_identical_code_passes(self):
+        asm = assembly(["add w0, w0, #1", "ret"], ["add w0, w0, #1", "ret"])
+        self.assertEqual(check_pair(asm, "f", 0), [])
+
+    def test_different_immediates_fail(self):
+        asm = assembly(["add w0, w0, #1", "ret"], ["add w0, w0, #2", "ret"])
+        self.assertEqual(len(check_pair(asm, "f", 0)), 1)
+
+    def test_different_code_of_same_length_fails_with_or_without_budget(self):
+        asm = assembly(["imull $3, %edi, %eax", "ret"], ["leal (%rdi,%rdi,2), %eax", "ret"])
+        self.assertEqual(len(check_pair(asm, "f", 0)), 1)
+        self.assertEqual(len(check_pair(asm, "f", 5)), 1)
+
+    def test_shorter_different_code_fails_with_or_without_budget(self):
+        asm = assembly(["movl %edi, %eax", "addl $1, %eax", "ret"], ["leal 1(%rdi), %eax", "ret"])
+        self.assertEqual(len(check_pair(asm, "f", 0)), 1)
+        self.assertEqual(len(check_pair(asm, "f", 5)), 1)
+
+    def test_longer_code_passes_only_within_positive_budget(self):
+        asm = assembly(["leal 1(%rdi), %eax", "ret"], ["movl %edi, %eax", "addl $1, %eax", "ret"])
+        self.assertEqual(len(check_pair(asm, "f", 0)), 1)
+        self.assertEqual(check_pair(asm, "f", 1), [])
+
+    def test_commuted_register_compare_passes(self):
+        raw = ["leal (%rdi,%rdi,2), %eax", "cmpl %esi, %eax", "setl %al", "ret"]
+        au = ["leal (%rdi,%rdi,2), %eax", "cmpl %eax, %esi", "setg %al", "ret"]
+        self.assertEqual(check_pair(assembly(raw, au), "f", 0), [])
+
+    def test_commuted_compare_with_different_condition_fails(self):
+        raw = ["cmpl %esi, %eax", "setl %al", "ret"]
+        au = ["cmpl %eax, %esi", "setl %al", "ret"]
+        self.assertEqual(len(check_pair(assembly(raw, au), "f", 0)), 1)
+
+    def test_commuted_compare_is_left_alone_if_other_instructions_read_flags(self):
+        raw = ["cmpl %esi, %eax", "setl %al", "cmovl %esi, %eax", "ret"]
+        au = ["cmpl %eax, %esi", "setg %al", "cmovl %esi, %eax", "ret"]
+        self.assertEqual(len(check_pair(assembly(raw, au), "f", 0)), 1)
+
+    def test_reordered_independent_multiplications_pass(self):
+        raw = ["mulsd %xmm2, %xmm0", "mulsd %xmm3, %xmm1", "comisd %xmm1, %xmm0", "ret"]
+        au = ["mulsd %xmm3, %xmm1", "mulsd %xmm2, %xmm0", "comisd %xmm1, %xmm0", "ret"]
+        self.assertEqual(check_pair(assembly(raw, au), "f", 0), [])
+
+    def test_reordered_dependent_multiplications_fail(self):
+        raw = ["mulsd %xmm1, %xmm0", "mulsd %xmm2, %xmm1", "ret"]
+        au = ["mulsd %xmm2, %xmm1", "mulsd %xmm1, %xmm0", "ret"]
+        self.assertEqual(len(check_pair(assembly(raw, au), "f", 0)), 1)
+
+    def test_reordered_aarch64_multiplications_pass(self):
+        raw = ["fmul d0, d0, d2", "fmul d1, d1, d3", "fcmp d0, d1", "ret"]
+        au = ["fmul d1, d1, d3", "fmul d0, d0, d2", "fcmp d0, d1", "ret"]
+        self.assertEqual(check_pair(assembly(raw, au), "f", 0), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
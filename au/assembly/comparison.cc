@@ -0,0 +1,46 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Comparisons between quantities in different units.
+//
+// Each `au_<name>` function must compile to the same machine code as `raw_<name>`.  See
+// `check_assembly_equivalence.py` for details.
+
+#include <cstdint>
+
+#include "au/prefix.hh"
+#include "au/quantity.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+
+using namespace au;
+
+extern "C" {
+
+bool raw_feet_lt_inches_i32(std::int32_t a, std::int32_t b) { return a * 12 < b; }
+bool au_feet_lt_inches_i32(std::int32_t a, std::int32_t b) { return feet(a) < inches(b); }
+
+bool raw_meters_eq_centimeters_i64(std::int64_t a, std::int64_t b) { return a * 100 == b; }
+bool au_meters_eq_centimeters_i64(std::int64_t a, std::int64_t b) {
+    return meters(a) == centi(meters)(b);
+}
+
+bool raw_meters_ge_feet_f64(double a, double b) { return a * 1250.0 >= b * 381.0; }
+bool au_meters_ge_feet_f64(double a, double b) { return meters(a) >= feet(b); }
+
+bool raw_same_unit_lt_u16(std::uint16_t a, std::uint16_t b) { return a < b; }
+bool au_same_unit_lt_u16(std::uint16_t a, std::uint16_t b) { return meters(a) < meters(b); }
+
+}  // extern "C"
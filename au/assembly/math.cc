@@ -0,0 +1,58 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The wrappers in `au/math.hh`.
+//
+// Each `au_<name>` function must compile to the same machine code as `raw_<name>`.  See
+// `check_assembly_equivalence.py` for details.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+#include "au/math.hh"
+#include "au/prefix.hh"
+#include "au/units/degrees.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+
+using namespace au;
+
+extern "C" {
+
+std::int32_t raw_abs_i32(std::int32_t x) { return std::abs(x); }
+std::int32_t au_abs_i32(std::int32_t x) { return abs(meters(x)).in(meters); }
+
+double raw_abs_f64(double x) { return std::fabs(x); }
+double au_abs_f64(double x) { return abs(meters(x)).in(meters); }
+
+double raw_sqrt_f64(double x) { return std::sqrt(x); }
+double au_sqrt_f64(double x) { return sqrt(squared(meters)(x)).in(meters); }
+
+double raw_sin_radians_f64(double x) { return std::sin(x); }
+double au_sin_radians_f64(double x) { return sin(radians(x)); }
+
+double raw_cos_degrees_f64(double x) { return std::cos(x * 0.017453292519943295); }
+double au_cos_degrees_f64(double x) { return cos(degrees(x)); }
+
+std::int64_t raw_min_mixed_i64(std::int64_t a, std::int64_t b) { return std::min(a * 100, b); }
+std::int64_t au_min_mixed_i64(std::int64_t a, std::int64_t b) {
+    return min(meters(a), centi(meters)(b)).in(centi(meters));
+}
+
+double raw_max_f64(double a, double b) { return std::max(a, b); }
+double au_max_f64(double a, double b) { return max(meters(a), meters(b)).in(meters); }
+
+}  // extern "C"
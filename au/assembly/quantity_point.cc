@@ -0,0 +1,47 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// `QuantityPoint` conversions between units whose origins differ.
+//
+// Each `au_<name>` function must compile to the same machine code as `raw_<name>`.  See
+// `check_assembly_equivalence.py` for details.
+
+#include <cstdint>
+
+#include "au/prefix.hh"
+#include "au/quantity_point.hh"
+#include "au/units/celsius.hh"
+#include "au/units/kelvins.hh"
+
+using namespace au;
+
+extern "C" {
+
+double raw_celsius_to_kelvins_f64(double x) { return x + 273.15; }
+double au_celsius_to_kelvins_f64(double x) { return celsius_pt(x).in(kelvins_pt); }
+
+double raw_kelvins_to_celsius_f64(double x) { return x - 273.15; }
+double au_kelvins_to_celsius_f64(double x) { return kelvins_pt(x).in(celsius_pt); }
+
+std::int32_t raw_celsius_to_millikelvins_i32(std::int32_t x) { return x * 1000 + 273'150; }
+std::int32_t au_celsius_to_millikelvins_i32(std::int32_t x) {
+    return celsius_pt(x).in(milli(kelvins_pt));
+}
+
+std::int64_t raw_millikelvins_to_celsius_i64(std::int64_t x) { return (x - 273'150) / 1000; }
+std::int64_t au_millikelvins_to_celsius_i64(std::int64_t x) {
+    return milli(kelvins_pt)(x).coerce_in(celsius_pt);
+}
+
+}  // extern "C"
@@ -0,0 +1,162 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "au/quantity.hh"
+
+namespace au {
+
+// `AtomicQuantity<U, R>`: a `Quantity<U, R>` which can be safely accessed from multiple threads.
+//
+// This wraps a `std::atomic<R>`, and mirrors its API, except that every value we accept or return
+// is a `Quantity<U, R>`.  Since parameters are `Quantity<U, R>` (rather than templates), any
+// quantity which is _implicitly_ convertible to `Quantity<U, R>` is accepted: the unit conversion
+// happens at the callsite, with the usual safety checks, before the atomic operation.
+//
+// As with `std::atomic`, whether this is lock-free depends on `R` and on the platform.
+template <typename UnitT, typename RepT>
+class AtomicQuantity {
+    static_assert(std::is_arithmetic<RepT>::value, "AtomicQuantity requires arithmetic Rep");
+
+ public:
+    using Rep = RepT;
+    using Unit = UnitT;
+    using QuantityType = Quantity<Unit, Rep>;
+
+    // Unlike `std::atomic` (before C++20), we value-initialize, to a quantity of zero.
+    constexpr AtomicQuantity() noexcept : value_{Rep{0}} {}
+
+    constexpr AtomicQuantity(QuantityType q) noexcept  // NOLINT(runtime/explicit)
+        : value_{q.in(Unit{})} {}
+
+    AtomicQuantity(const AtomicQuantity &) = delete;
+    AtomicQuantity &operator=(const AtomicQuantity &) = delete;
+
+    bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    QuantityType load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        return make_quantity<Unit>(value_.load(order));
+    }
+
+    void store(QuantityType q, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        value_.store(q.in(Unit{}), order);
+    }
+
+    QuantityType exchange(QuantityType q,
+                          std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return make_quantity<Unit>(value_.exchange(q.in(Unit{}), order));
+    }
+
+    bool compare_exchange_weak(QuantityType &expected,
+                               QuantityType desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept {
+        return value_.compare_exchange_weak(
+            expected.data_in(Unit{}), desired.in(Unit{}), success, failure);
+    }
+    bool compare_exchange_weak(QuantityType &expected,
+                               QuantityType desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return value_.compare_exchange_weak(expected.data_in(Unit{}), desired.in(Unit{}), order);
+    }
+
+    bool compare_exchange_strong(QuantityType &expected,
+                                 QuantityType desired,
+                                 std::memory_order success,
+                                 std::memory_order failure) noexcept {
+        return value_.compare_exchange_strong(
+            expected.data_in(Unit{}), desired.in(Unit{}), success, failure);
+    }
+    bool compare_exchange_strong(QuantityType &expected,
+                                 QuantityType desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return value_.compare_exchange_strong(expected.data_in(Unit{}), desired.in(Unit{}), order);
+    }
+
+    // Atomically add `delta`, and return the previous value.
+    QuantityType fetch_add(QuantityType delta,
+                           std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return make_quantity<Unit>(FetchOp::add(value_, delta.in(Unit{}), order));
+    }
+
+    // Atomically subtract `delta`, and return the previous value.
+    QuantityType fetch_sub(QuantityType delta,
+                           std::memory_order order = std::memory_order_seq_cst) noexcept {
+        return make_quantity<Unit>(FetchOp::sub(value_, delta.in(Unit{}), order));
+    }
+
+    // Shorthand for `fetch_add()` and `fetch_sub()` with sequentially consistent ordering.
+    //
+    // Like `std::atomic`, these return the _new_ value, rather than a reference to `*this`.
+    QuantityType operator+=(QuantityType delta) noexcept { return fetch_add(delta) + delta; }
+    QuantityType operator-=(QuantityType delta) noexcept { return fetch_sub(delta) - delta; }
+
+ private:
+    // `std::atomic` only provides `fetch_add` and `fetch_sub` for integral types before C++20.
+    // For other types, we emulate them with a compare-exchange loop.
+    struct IntegralFetchOp {
+        static Rep add(std::atomic<Rep> &x, Rep dx, std::memory_order order) noexcept {
+            return x.fetch_add(dx, order);
+        }
+        static Rep sub(std::atomic<Rep> &x, Rep dx, std::memory_order order) noexcept {
+            return x.fetch_sub(dx, order);
+        }
+    };
+    struct CompareExchangeFetchOp {
+        static Rep add(std::atomic<Rep> &x, Rep dx, std::memory_order order) noexcept {
+            Rep old = x.load(std::memory_order_relaxed);
+            while (!x.compare_exchange_weak(old, static_cast<Rep>(old + dx), order)) {
+            }
+            return old;
+        }
+        static Rep sub(std::atomic<Rep> &x, Rep dx, std::memory_order order) noexcept {
+            Rep old = x.load(std::memory_order_relaxed);
+            while (!x.compare_exchange_weak(old, static_cast<Rep>(old - dx), order)) {
+            }
+            return old;
+        }
+    };
+    using FetchOp =
+        std::conditional_t<std::is_integral<Rep>::value, IntegralFetchOp, CompareExchangeFetchOp>;
+
+    std::atomic<Rep> value_;
+};
+
+//
+// AtomicQuantity aliases to set a particular Rep.
+//
+// This presents a less cumbersome interface for end users.
+//
+template <typename UnitT>
+using AtomicQuantityD = AtomicQuantity<UnitT, double>;
+template <typename UnitT>
+using AtomicQuantityF = AtomicQuantity<UnitT, float>;
+template <typename UnitT>
+using AtomicQuantityI = AtomicQuantity<UnitT, int>;
+template <typename UnitT>
+using AtomicQuantityU = AtomicQuantity<UnitT, unsigned int>;
+template <typename UnitT>
+using AtomicQuantityI32 = AtomicQuantity<UnitT, int32_t>;
+template <typename UnitT>
+using AtomicQuantityU32 = AtomicQuantity<UnitT, uint32_t>;
+template <typename UnitT>
+using AtomicQuantityI64 = AtomicQuantity<UnitT, int64_t>;
+template <typename UnitT>
+using AtomicQuantityU64 = AtomicQuantity<UnitT, uint64_t>;
+
+}  // namespace au
@@ -0,0 +1,126 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/atomic_quantity.hh"
+
+#include <thread>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/bytes.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+
+TEST(AtomicQuantity, HasCorrectRepNamedAliases) {
+    StaticAssertTypeEq<AtomicQuantityD<Bytes>, AtomicQuantity<Bytes, double>>();
+    StaticAssertTypeEq<AtomicQuantityF<Bytes>, AtomicQuantity<Bytes, float>>();
+    StaticAssertTypeEq<AtomicQuantityI<Bytes>, AtomicQuantity<Bytes, int>>();
+    StaticAssertTypeEq<AtomicQuantityU<Bytes>, AtomicQuantity<Bytes, unsigned int>>();
+    StaticAssertTypeEq<AtomicQuantityI32<Bytes>, AtomicQuantity<Bytes, int32_t>>();
+    StaticAssertTypeEq<AtomicQuantityU32<Bytes>, AtomicQuantity<Bytes, uint32_t>>();
+    StaticAssertTypeEq<AtomicQuantityI64<Bytes>, AtomicQuantity<Bytes, int64_t>>();
+    StaticAssertTypeEq<AtomicQuantityU64<Bytes>, AtomicQuantity<Bytes, uint64_t>>();
+}
+
+TEST(AtomicQuantity, DefaultConstructsToZero) {
+    const AtomicQuantityU64<Bytes> total{};
+    EXPECT_THAT(total.load(), SameTypeAndValue(bytes(uint64_t{0})));
+}
+
+TEST(AtomicQuantity, CanLoadAndStore) {
+    AtomicQuantityD<Seconds> t{seconds(1.5)};
+    EXPECT_THAT(t.load(), SameTypeAndValue(seconds(1.5)));
+
+    t.store(seconds(2.5), std::memory_order_release);
+    EXPECT_THAT(t.load(std::memory_order_acquire), SameTypeAndValue(seconds(2.5)));
+
+    t.store(ZERO);
+    EXPECT_THAT(t.load(), SameTypeAndValue(seconds(0.0)));
+}
+
+TEST(AtomicQuantity, AcceptsImplicitlyConvertibleQuantities) {
+    AtomicQuantityU64<Bytes> total{kilo(bytes)(uint64_t{2})};
+    EXPECT_THAT(total.load(), SameTypeAndValue(bytes(uint64_t{2'000})));
+
+    EXPECT_TRUE((std::is_convertible<QuantityU64<Kilo<Bytes>>, Quantity<Bytes, uint64_t>>::value));
+    EXPECT_FALSE((std::is_convertible<QuantityU64<Bits>, Quantity<Bytes, uint64_t>>::value));
+}
+
+TEST(AtomicQuantity, ExchangeReturnsOldValue) {
+    AtomicQuantityI32<Bytes> x{bytes(3)};
+    EXPECT_THAT(x.exchange(bytes(5)), SameTypeAndValue(bytes(3)));
+    EXPECT_THAT(x.load(), SameTypeAndValue(bytes(5)));
+}
+
+TEST(AtomicQuantity, CompareExchangeUpdatesExpectedOnFailure) {
+    AtomicQuantityI32<Bytes> x{bytes(3)};
+
+    auto expected = bytes(4);
+    EXPECT_FALSE(x.compare_exchange_strong(expected, bytes(10)));
+    EXPECT_THAT(expected, SameTypeAndValue(bytes(3)));
+    EXPECT_THAT(x.load(), SameTypeAndValue(bytes(3)));
+
+    EXPECT_TRUE(x.compare_exchange_strong(
+        expected, bytes(10), std::memory_order_acq_rel, std::memory_order_acquire));
+    EXPECT_THAT(x.load(), SameTypeAndValue(bytes(10)));
+}
+
+TEST(AtomicQuantity, FetchAddAndSubReturnOldValue) {
+    AtomicQuantityU64<Bytes> total{};
+    EXPECT_THAT(total.fetch_add(kilo(bytes)(uint64_t{1})), SameTypeAndValue(bytes(uint64_t{0})));
+    EXPECT_THAT(total.fetch_sub(bytes(uint64_t{24}), std::memory_order_relaxed),
+                SameTypeAndValue(bytes(uint64_t{1'000})));
+    EXPECT_THAT(total.load(), SameTypeAndValue(bytes(uint64_t{976})));
+}
+
+TEST(AtomicQuantity, FetchAddWorksForFloatingPointRep) {
+    AtomicQuantityD<Seconds> cpu_time{};
+    cpu_time.fetch_add(milli(seconds)(250.0));
+    cpu_time.fetch_sub(seconds(0.125));
+    EXPECT_THAT(cpu_time.load(), SameTypeAndValue(seconds(0.125)));
+}
+
+TEST(AtomicQuantity, CompoundAssignmentReturnsNewValue) {
+    AtomicQuantityI32<Bytes> x{bytes(3)};
+    EXPECT_THAT(x += bytes(4), SameTypeAndValue(bytes(7)));
+    EXPECT_THAT(x -= bytes(10), SameTypeAndValue(bytes(-3)));
+}
+
+TEST(AtomicQuantity, ConcurrentFetchAddLosesNoUpdates) {
+    AtomicQuantityU64<Bytes> total{};
+    AtomicQuantityD<Seconds> cpu_time{};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1'000; ++j) {
+                total.fetch_add(kilo(bytes)(uint64_t{1}), std::memory_order_relaxed);
+                cpu_time.fetch_add(seconds(0.5), std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    EXPECT_THAT(total.load(), SameTypeAndValue(bytes(uint64_t{4'000'000})));
+    EXPECT_THAT(cpu_time.load(), SameTypeAndValue(seconds(2'000.0)));
+}
+
+}  // namespace au
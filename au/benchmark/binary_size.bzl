@@ -0,0 +1,43 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Helpers for measuring the size of the code which Au generates."""
+
+def object_file(name, src, copts = []):
+    """Compile `src` to an object file, `<name>.o`, at `-O2` (unless `copts` overrides it).
+
+    The object comes from whichever C++ toolchain is selected (see `--config` in `.bazelrc`).
+
+    Args:
+        name: The name of the target.
+        src: A C++ file which may include any Au header.
+        copts: Extra flags for the compiler.
+    """
+    native.genrule(
+        name = name,
+        srcs = [
+            src,
+            "//au:headers",
+        ],
+        outs = [name + ".o"],
+        cmd = "$(CC) $(CC_FLAGS) -std=c++14 -O2 {} -c -I. -o $@ $(location {})".format(
+            " ".join(copts),
+            src,
+        ),
+        toolchains = [
+            "@bazel_tools//tools/cpp:cc_flags",
+            "@bazel_tools//tools/cpp:current_cc_toolchain",
+        ],
+        tools = ["@bazel_tools//tools/cpp:current_cc_toolchain"],
+    )
@@ -0,0 +1,140 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Report the code, symbol table, and debug info sizes of ELF object files.
+
+For each file, we report the total size of its executable sections, of its symbol table (including
+the symbol names), and of its DWARF debug info sections; and how many functions it defines.  With
+`--compare`, and exactly two files, we also report how each size changed from the first to the
+second.
+
+We read the ELF headers directly, so that we don't depend on which binutils are installed.
+"""
+
+import argparse
+import struct
+import sys
+
+SHF_EXECINSTR = 0x4
+SHT_SYMTAB = 2
+SYMBOL_TABLE_SECTIONS = (".symtab", ".strtab")
+DWARF_SECTION_PREFIXES = (".debug_", ".zdebug_")
+STT_FUNC = 2
+SHN_UNDEF = 0
+
+
+class ElfFile:
+    """The parts of an ELF file's section headers and symbol table which we need."""
+
+    def __init__(self, data):
+        if data[:4] != b"\x7fELF":
+            raise ValueError("not an ELF file")
+        is_64_bit = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+
+        if is_64_bit:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x3A)
+            section_format = endian + "IIQQQQIIQQ"
+            self._symbol_format = endian + "IBBHQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x2E)
+            section_format = endian + "IIIIIIIIII"
+            self._symbol_format = endian + "IIIBBH"
+        self._is_64_bit = is_64_bit
+        self._data = data
+
+        # Each section is a tuple: (name offset, type, flags, addr, offset, size, link, info,
+        # alignment, entry size).
+        self.sections = [
+            struct.unpack_from(section_format, data, shoff + i * shentsize) for i in range(shnum)
+        ]
+        names_offset = self.sections[shstrndx][4]
+        self.section_names = [
+            data[names_offset + s[0] : data.index(b"\0", names_offset + s[0])].decode()
+            for s in self.sections
+        ]
+
+    def executable_bytes(self):
+        return sum(s[5] for s in self.sections if s[2] & SHF_EXECINSTR)
+
+    def symbol_table_bytes(self):
+        return sum(
+            s[5] for s, n in zip(self.sections, self.section_names) if n in SYMBOL_TABLE_SECTIONS
+        )
+
+    def dwarf_bytes(self):
+        return sum(
+            s[5]
+            for s, n in zip(self.sections, self.section_names)
+            if n.startswith(DWARF_SECTION_PREFIXES)
+        )
+
+    def symbols(self):
+        """Yield (type, section index, size) for every symbol."""
+        for section in self.sections:
+            if section[1] != SHT_SYMTAB:
+                continue
+            offset, size, entry_size = section[4], section[5], section[9]
+            for pos in range(offset, offset + size, entry_size):
+                fields = struct.unpack_from(self._symbol_format, self._data, pos)
+                if self._is_64_bit:
+                    _, info, _, shndx, _, sym_size = fields
+                else:
+                    _, _, sym_size, info, _, shndx = fields
+                yield info & 0xF, shndx, sym_size
+
+    def num_defined_functions(self):
+        return sum(1 for t, shndx, _ in self.symbols() if t == STT_FUNC and shndx != SHN_UNDEF)
+
+
+def measure(path):
+    """The sizes we report for the file at `path`, as a list of (label, value) pairs."""
+    with open(path, "rb") as f:
+        elf = ElfFile(f.read())
+    return [
+        ("code bytes", elf.executable_bytes()),
+        ("symbol table bytes", elf.symbol_table_bytes()),
+        ("DWARF bytes", elf.dwarf_bytes()),
+        ("functions", elf.num_defined_functions()),
+    ]
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("object_files", nargs="+")
+    parser.add_argument(
+        "--compare",
+        action="store_true",
+        help="Report how each size changed from the first file to the second",
+    )
+    args = parser.parse_args(argv)
+
+    results = [measure(path) for path in args.object_files]
+    for path, sizes in zip(args.object_files, results):
+        print("{}:".format(path))
+        for label, value in sizes:
+            print("  {:>10}  {}".format(value, label))
+
+    if args.compare and len(results) == 2:
+        print("Change:")
+        for (label, before), (_, after) in zip(*results):
+            if before > 0:
+                print("  {:>+9.1f}%  {}".format(100.0 * (after - before) / before, label))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,374 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks comparing Au operations against the equivalent hand-written raw arithmetic.
+//
+// Every Au benchmark `BM_Au<Name>` has a baseline `BM_Raw<Name>`, which does the same arithmetic on
+// plain numbers.  Au aims to be zero-overhead, so each pair should run at the same speed.  Each
+// benchmark applies its operation to a whole buffer of values, so that the timing is dominated by
+// the operation itself, rather than by the benchmark loop.
+//
+// Run with optimizations enabled:
+//
+//     bazel run -c opt //au/benchmark:conversion_benchmark
+//
+// Unit conversions are grouped by the category the conversion factor falls into, which determines
+// how Au applies it (see `ApplyAs` in `"au/apply_magnitude.hh"`):
+//
+//   - INTEGER_MULTIPLY:    feet to inches (x 12)
+//   - INTEGER_DIVIDE:      inches to feet (/ 12)
+//   - RATIONAL_MULTIPLY:   inches to centimeters (x 127/50, or x 2.54 for floating point)
+//   - IRRATIONAL_MULTIPLY: degrees to radians (x pi/180); floating point only, since Au forbids
+//                          irrational conversion factors for integer reps.
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/units/celsius.hh"
+#include "au/units/degrees.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+#include "benchmark/benchmark.h"
+
+namespace au {
+namespace {
+
+constexpr std::size_t BUFFER_SIZE = 1024u;
+
+// Small positive values, so that every conversion we benchmark fits in every rep (even `int8_t`).
+template <typename T>
+std::vector<T> make_values() {
+    std::vector<T> values(BUFFER_SIZE);
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        values[i] = static_cast<T>(1u + (i * 7u) % 10u);
+    }
+    return values;
+}
+
+template <typename U, typename T>
+std::vector<Quantity<U, T>> make_quantities() {
+    const auto values = make_values<T>();
+    std::vector<Quantity<U, T>> quantities;
+    quantities.reserve(values.size());
+    for (const auto x : values) {
+        quantities.push_back(make_quantity<U>(x));
+    }
+    return quantities;
+}
+
+template <typename U, typename T>
+std::vector<QuantityPoint<U, T>> make_points() {
+    const auto values = make_values<T>();
+    std::vector<QuantityPoint<U, T>> points;
+    points.reserve(values.size());
+    for (const auto x : values) {
+        points.push_back(make_quantity_point<U>(x));
+    }
+    return points;
+}
+
+// Apply `op` to each element of `in`, storing the result in `out`, once per benchmark iteration.
+template <typename In, typename Out, typename Op>
+void run(benchmark::State &state, const std::vector<In> &in, std::vector<Out> &out, Op op) {
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < in.size(); ++i) {
+            out[i] = op(in[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(in.size()));
+}
+
+// Like `run()`, but for binary operations on corresponding elements of `a` and `b`.
+template <typename A, typename B, typename Out, typename Op>
+void run(benchmark::State &state,
+         const std::vector<A> &a,
+         const std::vector<B> &b,
+         std::vector<Out> &out,
+         Op op) {
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < a.size(); ++i) {
+            out[i] = op(a[i], b[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(a.size()));
+}
+
+// The raw-arithmetic equivalent of the irrational conversion factor we use.
+template <typename T>
+using FloatFor = std::conditional_t<std::is_same<T, float>::value, float, double>;
+template <typename T>
+constexpr FloatFor<T> DEGREES_TO_RADIANS = get_value<FloatFor<T>>(unit_ratio(degrees, radians));
+
+// The raw-arithmetic equivalent of the rational conversion factor we use.  Au multiplies integers by
+// the numerator and divides by the denominator, but multiplies floating point values by the single
+// precomputed factor (2.54), so our baseline must do the same.
+template <typename T>
+constexpr T INCHES_TO_CENTIMETERS = get_value<T>(unit_ratio(inches, centi(meters)));
+template <typename T>
+T inches_to_centimeters(T x, std::true_type /* is_floating_point */) {
+    return x * INCHES_TO_CENTIMETERS<T>;
+}
+template <typename T>
+T inches_to_centimeters(T x, std::false_type /* is_floating_point */) {
+    return static_cast<T>(x * 127 / 50);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Unit conversions: `.in<T>(unit)` and `.as<T>(unit)`, by conversion category.
+
+template <typename T>
+void BM_RawIntegerMultiply(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) { return static_cast<T>(x * 12); });
+}
+
+template <typename T>
+void BM_AuIntegerMultiplyIn(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_quantities<Feet, T>(), out, [](Quantity<Feet, T> x) {
+        return x.template in<T>(inches);
+    });
+}
+
+template <typename T>
+void BM_AuIntegerMultiplyAs(benchmark::State &state) {
+    std::vector<Quantity<Inches, T>> out(BUFFER_SIZE);
+    run(state, make_quantities<Feet, T>(), out, [](Quantity<Feet, T> x) {
+        return x.template as<T>(inches);
+    });
+}
+
+template <typename T>
+void BM_RawIntegerDivide(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) { return static_cast<T>(x / 12); });
+}
+
+template <typename T>
+void BM_AuIntegerDivideIn(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_quantities<Inches, T>(), out, [](Quantity<Inches, T> x) {
+        return x.template in<T>(feet);
+    });
+}
+
+template <typename T>
+void BM_RawRationalMultiply(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) {
+        return inches_to_centimeters(x, std::is_floating_point<T>{});
+    });
+}
+
+template <typename T>
+void BM_AuRationalMultiplyIn(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_quantities<Inches, T>(), out, [](Quantity<Inches, T> x) {
+        return x.template in<T>(centi(meters));
+    });
+}
+
+template <typename T>
+void BM_RawIrrationalMultiply(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) {
+        return static_cast<T>(x * DEGREES_TO_RADIANS<T>);
+    });
+}
+
+template <typename T>
+void BM_AuIrrationalMultiplyIn(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_quantities<Degrees, T>(), out, [](Quantity<Degrees, T> x) {
+        return x.template in<T>(radians);
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// QuantityPoint conversions: Celsius to milli-Kelvins (integer multiply plus origin offset).
+
+// The result rep is wide enough to hold the offset, even for 8-bit inputs.
+template <typename T>
+using PointResultRep = std::common_type_t<T, int64_t>;
+
+template <typename T>
+void BM_RawPointConversion(benchmark::State &state) {
+    using R = PointResultRep<T>;
+    std::vector<R> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) {
+        return static_cast<R>(static_cast<R>(x) * 1'000 + 273'150);
+    });
+}
+
+template <typename T>
+void BM_AuPointConversion(benchmark::State &state) {
+    std::vector<PointResultRep<T>> out(BUFFER_SIZE);
+    run(state, make_points<Celsius, T>(), out, [](QuantityPoint<Celsius, T> p) {
+        return p.template in<PointResultRep<T>>(milli(kelvins_pt));
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Mixed-unit arithmetic and comparison: feet and inches, computed in inches.
+//
+// Au forbids these for 8- and 16-bit reps, because of the overflow risk in converting to inches.
+
+template <typename T>
+void BM_RawMixedAddition(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), make_values<T>(), out, [](T a, T b) {
+        return static_cast<T>(a * 12 + b);
+    });
+}
+
+template <typename T>
+void BM_AuMixedAddition(benchmark::State &state) {
+    std::vector<Quantity<Inches, T>> out(BUFFER_SIZE);
+    run(state,
+        make_quantities<Feet, T>(),
+        make_quantities<Inches, T>(),
+        out,
+        [](Quantity<Feet, T> a, Quantity<Inches, T> b) {
+            return rep_cast<T>(a + b);
+        });
+}
+
+template <typename T>
+void BM_RawMixedComparison(benchmark::State &state) {
+    std::vector<uint8_t> out(BUFFER_SIZE);
+    run(state, make_values<T>(), make_values<T>(), out, [](T a, T b) { return a * 12 < b; });
+}
+
+template <typename T>
+void BM_AuMixedComparison(benchmark::State &state) {
+    std::vector<uint8_t> out(BUFFER_SIZE);
+    run(state,
+        make_quantities<Feet, T>(),
+        make_quantities<Inches, T>(),
+        out,
+        [](Quantity<Feet, T> a, Quantity<Inches, T> b) { return a < b; });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions from `"au/math.hh"`.
+
+template <typename T>
+void BM_RawAbs(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) { return static_cast<T>(std::abs(x)); });
+}
+
+template <typename T>
+void BM_AuAbs(benchmark::State &state) {
+    std::vector<Quantity<Meters, T>> out(BUFFER_SIZE);
+    run(state, make_quantities<Meters, T>(), out, [](Quantity<Meters, T> x) { return abs(x); });
+}
+
+template <typename T>
+void BM_RawSqrt(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) { return std::sqrt(x); });
+}
+
+template <typename T>
+void BM_AuSqrt(benchmark::State &state) {
+    std::vector<Quantity<decltype(root<2>(squared(Meters{}))), T>> out(BUFFER_SIZE);
+    run(state, make_quantities<decltype(squared(Meters{})), T>(), out, [](auto x) {
+        return sqrt(x);
+    });
+}
+
+template <typename T>
+void BM_RawSin(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_values<T>(), out, [](T x) { return std::sin(x * DEGREES_TO_RADIANS<T>); });
+}
+
+template <typename T>
+void BM_AuSin(benchmark::State &state) {
+    std::vector<T> out(BUFFER_SIZE);
+    run(state, make_quantities<Degrees, T>(), out, [](Quantity<Degrees, T> x) { return sin(x); });
+}
+
+}  // namespace
+
+// Register each benchmark for every integral width, and for floating point.
+#define AU_BENCHMARK_ALL_REPS(fn)     \
+    BENCHMARK_TEMPLATE(fn, int8_t);   \
+    BENCHMARK_TEMPLATE(fn, int16_t);  \
+    BENCHMARK_TEMPLATE(fn, int32_t);  \
+    BENCHMARK_TEMPLATE(fn, int64_t);  \
+    BENCHMARK_TEMPLATE(fn, uint8_t);  \
+    BENCHMARK_TEMPLATE(fn, uint16_t); \
+    BENCHMARK_TEMPLATE(fn, uint32_t); \
+    BENCHMARK_TEMPLATE(fn, uint64_t); \
+    BENCHMARK_TEMPLATE(fn, float);    \
+    BENCHMARK_TEMPLATE(fn, double)
+
+#define AU_BENCHMARK_WIDE_REPS(fn)    \
+    BENCHMARK_TEMPLATE(fn, int32_t);  \
+    BENCHMARK_TEMPLATE(fn, int64_t);  \
+    BENCHMARK_TEMPLATE(fn, uint32_t); \
+    BENCHMARK_TEMPLATE(fn, uint64_t); \
+    BENCHMARK_TEMPLATE(fn, float);    \
+    BENCHMARK_TEMPLATE(fn, double)
+
+#define AU_BENCHMARK_FLOATING_REPS(fn) \
+    BENCHMARK_TEMPLATE(fn, float);     \
+    BENCHMARK_TEMPLATE(fn, double)
+
+AU_BENCHMARK_ALL_REPS(BM_RawIntegerMultiply);
+AU_BENCHMARK_ALL_REPS(BM_AuIntegerMultiplyIn);
+AU_BENCHMARK_ALL_REPS(BM_AuIntegerMultiplyAs);
+
+AU_BENCHMARK_ALL_REPS(BM_RawIntegerDivide);
+AU_BENCHMARK_ALL_REPS(BM_AuIntegerDivideIn);
+
+AU_BENCHMARK_ALL_REPS(BM_RawRationalMultiply);
+AU_BENCHMARK_ALL_REPS(BM_AuRationalMultiplyIn);
+
+AU_BENCHMARK_FLOATING_REPS(BM_RawIrrationalMultiply);
+AU_BENCHMARK_FLOATING_REPS(BM_AuIrrationalMultiplyIn);
+
+AU_BENCHMARK_ALL_REPS(BM_RawPointConversion);
+AU_BENCHMARK_ALL_REPS(BM_AuPointConversion);
+
+AU_BENCHMARK_WIDE_REPS(BM_RawMixedAddition);
+AU_BENCHMARK_WIDE_REPS(BM_AuMixedAddition);
+
+AU_BENCHMARK_WIDE_REPS(BM_RawMixedComparison);
+AU_BENCHMARK_WIDE_REPS(BM_AuMixedComparison);
+
+AU_BENCHMARK_FLOATING_REPS(BM_RawAbs);
+AU_BENCHMARK_FLOATING_REPS(BM_AuAbs);
+
+AU_BENCHMARK_FLOATING_REPS(BM_RawSqrt);
+AU_BENCHMARK_FLOATING_REPS(BM_AuSqrt);
+
+AU_BENCHMARK_FLOATING_REPS(BM_RawSin);
+AU_BENCHMARK_FLOATING_REPS(BM_AuSin);
+
+}  // namespace au
@@ -0,0 +1,123 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate a C++ file which uses Au heavily, for measuring symbol and debug info sizes.
+
+The file defines one non-inline function for each of the operations that real code does most:
+products and quotients of quantities in different units (which make compound units), conversions
+between units of the same dimension (including prefixed units and computed products), mixed-unit
+arithmetic, and quantity point conversions.  Every function's signature mentions the unit types
+involved, just as in real code.
+"""
+
+import argparse
+import itertools
+import sys
+
+# Each entry: (unit type, header name, quantity maker, same-dimension alternative maker).
+UNITS = [
+    ("Meters", "meters", "meters", "feet"),
+    ("Feet", "feet", "feet", "inches"),
+    ("Seconds", "seconds", "seconds", "minutes"),
+    ("Hours", "hours", "hours", "seconds"),
+    ("Kilo<Grams>", "grams", "kilo(grams)", "pounds_mass"),
+    ("Newtons", "newtons", "newtons", "pounds_force"),
+    ("Joules", "joules", "joules", "kilo(joules)"),
+    ("Watts", "watts", "watts", "milli(watts)"),
+    ("Radians", "radians", "radians", "degrees"),
+    ("Amperes", "amperes", "amperes", "milli(amperes)"),
+    ("Volts", "volts", "volts", "kilo(volts)"),
+    ("Pascals", "pascals", "pascals", "bars"),
+]
+
+EXTRA_HEADERS = ["bars", "degrees", "inches", "minutes", "pounds_force", "pounds_mass"]
+
+POINT_CONVERSIONS = [
+    ("Celsius", "kelvins_pt"),
+    ("Fahrenheit", "celsius_pt"),
+    ("Kelvins", "fahrenheit_pt"),
+]
+POINT_HEADERS = ["celsius", "fahrenheit", "kelvins"]
+
+LICENSE = """\
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+"""
+
+
+def generate():
+    headers = sorted(set([u[1] for u in UNITS] + EXTRA_HEADERS + POINT_HEADERS))
+    lines = [LICENSE, "// GENERATED by generate_heavy_usage.py: do not edit.", ""]
+    lines += ['#include "au/au.hh"']
+    lines += ['#include "au/units/{}.hh"'.format(h) for h in headers]
+    lines += ["", "namespace au {", ""]
+
+    for i, (unit, _, maker, alternative) in enumerate(UNITS):
+        lines += [
+            "auto convert_{i}(QuantityD<{u}> x) {{ return x.as({alt}); }}".format(
+                i=i, u=unit, alt=alternative
+            ),
+            "auto convert_prefixed_{i}(QuantityD<{u}> x) {{ return x.in(milli({m})); }}".format(
+                i=i, u=unit, m=maker.replace("kilo(", "(")
+            ),
+            "auto sum_{i}(QuantityI32<{u}> a, QuantityI32<{u}> b) {{ return a + b; }}".format(
+                i=i, u=unit
+            ),
+        ]
+
+    for (i, a), (j, b) in itertools.combinations(enumerate(UNITS), 2):
+        lines += [
+            "auto product_{i}_{j}(QuantityD<{a}> a, QuantityD<{b}> b) {{ return a * b; }}".format(
+                i=i, j=j, a=a[0], b=b[0]
+            ),
+            "auto quotient_{i}_{j}(QuantityD<{a}> a, QuantityD<{b}> b) {{".format(
+                i=i, j=j, a=a[0], b=b[0]
+            ),
+            "    return (a / b).as({am} / {bm});".format(am=a[3], bm=b[3]),
+            "}",
+        ]
+
+    for i, (unit, target) in enumerate(POINT_CONVERSIONS):
+        lines += [
+            "auto convert_point_{i}(QuantityPointD<{u}> p) {{ return p.as({t}); }}".format(
+                i=i, u=unit, t=target
+            )
+        ]
+
+    lines += ["", "}  // namespace au", ""]
+    return "\n".join(lines)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args(argv)
+    with open(args.output, "w") as f:
+        f.write(generate())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,105 @@
+# Copyright 2023 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Report how much it costs to include each of the given Au headers in a translation unit.
+
+For each header, we compile a file which does nothing but include it, and report how many lines
+the preprocessor produces, the fastest of several runs of preprocessing alone (`-E`) and of parsing
+(`-fsyntax-only`), and which standard library headers it pulls in.
+
+Run this from the root of the repository (`bazel run` does this automatically), so that the headers
+resolve against the working tree.  Compare two commits by running it on each of them.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_HEADERS = [
+    "au/zero.hh",
+    "au/quantity.hh",
+    "au/units/meters.hh",
+    "au/core.hh",
+    "au/chrono_interop.hh",
+    "au/hash.hh",
+    "au/math.hh",
+    "au/au.hh",
+    "au/io.hh",
+]
+
+# A line marker for a standard library header, such as `# 1 "/usr/include/c++/13/chrono" 1 3`.
+STD_HEADER_MARKER = re.compile(r'^# \d+ "[^"]*/c\+\+/(?:v1/)?[^"/]+/([a-z_]+)"', re.MULTILINE)
+
+
+def fastest_run(command, repetitions):
+    """The shortest wall time, in seconds, over several runs of `command`."""
+    fastest = None
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+        elapsed = time.perf_counter() - start
+        fastest = elapsed if fastest is None else min(fastest, elapsed)
+    return fastest
+
+
+def measure(header, compiler, std, repetitions):
+    """A dict of the costs of a translation unit which includes `header`."""
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "include_only.cc")
+        with open(source, "w") as f:
+            f.write('#include "{}"\n'.format(header))
+        base = [compiler, "-std=" + std, "-I.", source]
+
+        preprocessed = subprocess.run(
+            base + ["-E"], check=True, stdout=subprocess.PIPE, universal_newlines=True
+        ).stdout
+        return {
+            "lines": preprocessed.count("\n"),
+            "preprocess": fastest_run(base + ["-E", "-o", os.devnull], repetitions),
+            "parse": fastest_run(base + ["-fsyntax-only"], repetitions),
+            "std_headers": sorted(set(STD_HEADER_MARKER.findall(preprocessed))),
+        }
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("headers", nargs="*", default=DEFAULT_HEADERS)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--repetitions", type=int, default=5)
+    args = parser.parse_args(argv)
+
+    workspace = os.environ.get("BUILD_WORKSPACE_DIRECTORY")
+    if workspace:
+        os.chdir(workspace)
+
+    print("{:<24}  {:>8}  {:>9}  {:>10}".format("header", "lines", "-E (ms)", "parse (ms)"))
+    for header in args.headers:
+        m = measure(header, compiler=args.compiler, std=args.std, repetitions=args.repetitions)
+        print(
+            "{:<24}  {:>8}  {:>9.1f}  {:>10.1f}".format(
+                header, m["lines"], 1000.0 * m["preprocess"], 1000.0 * m["parse"]
+            )
+        )
+        print("    std: {}".format(" ".join(m["std_headers"])))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,103 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A generic algorithm over quantities, used in many units, for measuring code size.
+//
+// We compile this file twice.  By default, the algorithm is a plain template on the `Quantity`
+// type, so we get one copy of its machine code (including `std::sort`) for every unit.  With
+// `-DAU_USE_UNIT_ERASED_CALL=1`, it's a thin shell around a kernel which `unit_erased_call()`
+// runs on raw numbers, so we get one copy per rep.  See `binary_size.py` for how to compare them.
+
+#include <algorithm>
+#include <cstddef>
+
+#include "au/au.hh"
+#include "au/unit_erased_call.hh"
+#include "au/units/feet.hh"
+#include "au/units/hours.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "au/units/minutes.hh"
+#include "au/units/miles.hh"
+#include "au/units/newtons.hh"
+#include "au/units/seconds.hh"
+#include "au/units/yards.hh"
+
+#ifndef AU_USE_UNIT_ERASED_CALL
+#define AU_USE_UNIT_ERASED_CALL 0
+#endif
+
+namespace au {
+namespace {
+
+// The mean of the values, ignoring the smallest and largest quarter.  Sorts `values` in place.
+#if AU_USE_UNIT_ERASED_CALL
+struct InterquartileMean {
+    template <typename T>
+    T operator()(stdx::span<T> values) const {
+        std::sort(values.begin(), values.end());
+        const std::size_t begin = values.size() / 4u;
+        const std::size_t end = values.size() - begin;
+        T total{0};
+        for (std::size_t i = begin; i < end; ++i) {
+            total += values[i];
+        }
+        return (end > begin) ? total / static_cast<T>(end - begin) : T{0};
+    }
+};
+
+template <typename U, typename R>
+Quantity<U, R> interquartile_mean(stdx::span<Quantity<U, R>> values) {
+    return unit_erased_call(InterquartileMean{}, values);
+}
+#else
+template <typename U, typename R>
+Quantity<U, R> interquartile_mean(stdx::span<Quantity<U, R>> values) {
+    std::sort(values.begin(), values.end());
+    const std::size_t begin = values.size() / 4u;
+    const std::size_t end = values.size() - begin;
+    auto total = make_quantity<U>(R{0});
+    for (std::size_t i = begin; i < end; ++i) {
+        total += values[i];
+    }
+    return (end > begin) ? total / static_cast<R>(end - begin) : make_quantity<U>(R{0});
+}
+#endif
+
+}  // namespace
+
+// Non-template entry points, so that every instantiation gets emitted.
+#define AU_DEFINE_INTERQUARTILE_MEAN(NAME, UNIT)                                               \
+    Quantity<UNIT, double> interquartile_mean_##NAME(stdx::span<Quantity<UNIT, double>> xs) { \
+        return interquartile_mean(xs);                                                         \
+    }
+
+AU_DEFINE_INTERQUARTILE_MEAN(meters, Meters)
+AU_DEFINE_INTERQUARTILE_MEAN(centimeters, Centi<Meters>)
+AU_DEFINE_INTERQUARTILE_MEAN(millimeters, Milli<Meters>)
+AU_DEFINE_INTERQUARTILE_MEAN(kilometers, Kilo<Meters>)
+AU_DEFINE_INTERQUARTILE_MEAN(inches, Inches)
+AU_DEFINE_INTERQUARTILE_MEAN(feet, Feet)
+AU_DEFINE_INTERQUARTILE_MEAN(yards, Yards)
+AU_DEFINE_INTERQUARTILE_MEAN(miles, Miles)
+AU_DEFINE_INTERQUARTILE_MEAN(seconds, Seconds)
+AU_DEFINE_INTERQUARTILE_MEAN(milliseconds, Milli<Seconds>)
+AU_DEFINE_INTERQUARTILE_MEAN(minutes, Minutes)
+AU_DEFINE_INTERQUARTILE_MEAN(hours, Hours)
+AU_DEFINE_INTERQUARTILE_MEAN(meters_per_second, decltype(Meters{} / Seconds{}))
+AU_DEFINE_INTERQUARTILE_MEAN(miles_per_hour, decltype(Miles{} / Hours{}))
+AU_DEFINE_INTERQUARTILE_MEAN(newtons, Newtons)
+AU_DEFINE_INTERQUARTILE_MEAN(kilonewtons, Kilo<Newtons>)
+
+}  // namespace au
@@ -0,0 +1,53 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <type_traits>
+
+#include "au/quantity.hh"
+#include "au/stdx/span.hh"
+
+namespace au {
+
+// Support for `std::complex` as a rep lives in `"au/rep.hh"`, so that every file which uses a
+// complex `Quantity` sees it.  This file holds utilities for working with buffers of them.
+
+// View a contiguous range of `Quantity<U, std::complex<T>>` as a span of `T`, without copying.
+//
+// The result holds the real and imaginary parts of each value in turn, so it has twice as many
+// elements as `quantities`.  This is the interleaved layout which FFT libraries expect.  A range of
+// `const` quantities gives a span of `const T`.
+//
+// This only goes one way.  The standard lets us access a `std::complex<T>` as a `T[2]`, and each
+// `Quantity` here really holds one.  A buffer of `T` holds no `Quantity` objects, so we can't view
+// it as one; copy the values instead.
+template <typename C>
+auto as_interleaved_span(C &&quantities) {
+    const auto span = stdx::make_span(quantities);
+    using Element = typename decltype(span)::element_type;
+    using Rep = typename std::remove_const_t<Element>::Rep;
+    using T = RealPartT<Rep>;
+    using Result = std::conditional_t<std::is_const<Element>::value, const T, T>;
+
+    static_assert(std::is_same<Rep, std::complex<T>>::value,
+                  "as_interleaved_span() requires Quantity values with a std::complex rep");
+    static_assert(sizeof(Element) == 2u * sizeof(T) && alignof(Element) == alignof(T),
+                  "Internal library error: complex Quantity layout differs from T[2]");
+
+    return stdx::span<Result>{reinterpret_cast<Result *>(span.data()), 2u * span.size()};
+}
+
+}  // namespace au
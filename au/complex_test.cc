@@ -0,0 +1,96 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/complex.hh"
+
+#include <complex>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+namespace {
+
+using ComplexD = std::complex<double>;
+using ComplexF = std::complex<float>;
+
+}  // namespace
+
+TEST(ComplexRep, ConvertsUnitsOfRealAndImaginaryParts) {
+    EXPECT_THAT(meters(ComplexD{1.5, -2.0}).as(centi(meters)),
+                SameTypeAndValue(centi(meters)(ComplexD{150.0, -200.0})));
+    EXPECT_THAT(feet(ComplexF{1.0f, -2.0f}).as(inches),
+                SameTypeAndValue(inches(ComplexF{12.0f, -24.0f})));
+    EXPECT_EQ(centi(meters)(ComplexD{250.0, 50.0}).in(meters), (ComplexD{2.5, 0.5}));
+}
+
+TEST(ComplexRep, ImplicitlyConvertsLikeItsRealPart) {
+    EXPECT_TRUE((std::is_convertible<Quantity<Meters, ComplexD>,
+                                     Quantity<Centi<Meters>, ComplexD>>::value));
+    EXPECT_TRUE((std::is_convertible<Quantity<Inches, ComplexD>,
+                                     Quantity<Feet, ComplexD>>::value));
+
+    const Quantity<Centi<Meters>, ComplexD> length = meters(ComplexD{1.0, 2.0});
+    EXPECT_EQ(length, centi(meters)(ComplexD{100.0, 200.0}));
+}
+
+TEST(ComplexRep, ImplicitlyConvertsFromRealButNotToReal) {
+    EXPECT_TRUE((std::is_convertible<QuantityD<Meters>, Quantity<Meters, ComplexD>>::value));
+    EXPECT_FALSE((std::is_convertible<Quantity<Meters, ComplexD>, QuantityD<Meters>>::value));
+
+    const Quantity<Centi<Meters>, ComplexD> length = meters(0.5);
+    EXPECT_EQ(length, centi(meters)(ComplexD{50.0, 0.0}));
+}
+
+TEST(ComplexRep, SupportsArithmetic) {
+    const auto a = meters(ComplexD{1.0, 2.0});
+    const auto b = meters(ComplexD{3.0, -1.0});
+    EXPECT_EQ(a + b, meters(ComplexD{4.0, 1.0}));
+    EXPECT_EQ(a - b, meters(ComplexD{-2.0, 3.0}));
+    EXPECT_EQ(a * b, squared(meters)(ComplexD{5.0, 5.0}));
+    EXPECT_EQ(a / seconds(2.0), (meters / second)(ComplexD{0.5, 1.0}));
+}
+
+TEST(ComplexRep, ChecksOverflowOfEachPart) {
+    EXPECT_FALSE(will_conversion_overflow(meters(ComplexF{1.0f, 2.0f}), nano(meters)));
+    EXPECT_TRUE(will_conversion_overflow(meters(ComplexF{1.0f, 1e35f}), nano(meters)));
+    EXPECT_TRUE(will_conversion_overflow(meters(ComplexF{-1e35f, 1.0f}), nano(meters)));
+}
+
+TEST(AsInterleavedSpan, ViewsComplexQuantitiesAsRealAndImaginaryParts) {
+    std::vector<Quantity<Meters, ComplexD>> values{meters(ComplexD{1.0, 2.0}),
+                                                   meters(ComplexD{3.0, 4.0})};
+    const auto parts = as_interleaved_span(values);
+    StaticAssertTypeEq<decltype(parts), const stdx::span<double>>();
+    EXPECT_THAT((std::vector<double>{parts.begin(), parts.end()}), ElementsAre(1.0, 2.0, 3.0, 4.0));
+
+    parts[3] = -4.0;
+    EXPECT_EQ(values[1], meters(ComplexD{3.0, -4.0}));
+}
+
+TEST(AsInterleavedSpan, PreservesConstness) {
+    const std::vector<Quantity<Meters, ComplexF>> values{meters(ComplexF{1.0f, 2.0f})};
+    StaticAssertTypeEq<decltype(as_interleaved_span(values)), stdx::span<const float>>();
+}
+
+}  // namespace au
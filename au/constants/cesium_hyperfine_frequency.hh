@@ -0,0 +1,40 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/constant.hh"
+#include "au/units/hertz.hh"
+
+namespace au {
+
+// The hyperfine transition frequency of cesium 133, Delta_nu_Cs, which defines the second.  Exact,
+// by definition of the SI.
+//
+// DO NOT follow this pattern to define your own units.  This is for library-defined units.
+// Instead, follow instructions at (https://aurora-opensource.github.io/au/main/howto/new-units/).
+template <typename T>
+struct CesiumHyperfineFrequencyLabel {
+    static constexpr const char label[] = "Delta_nu_Cs";
+};
+template <typename T>
+constexpr const char CesiumHyperfineFrequencyLabel<T>::label[];
+struct CesiumHyperfineFrequencyUnit : decltype(Hertz{} * mag<9'192'631'770>()),
+                                      CesiumHyperfineFrequencyLabel<void> {
+    using CesiumHyperfineFrequencyLabel<void>::label;
+};
+
+constexpr auto CESIUM_HYPERFINE_FREQUENCY = make_constant(CesiumHyperfineFrequencyUnit{});
+
+}  // namespace au
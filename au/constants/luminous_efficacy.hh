@@ -0,0 +1,41 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/constant.hh"
+#include "au/units/lumens.hh"
+#include "au/units/watts.hh"
+
+namespace au {
+
+// The luminous efficacy of 540 THz monochromatic radiation, K_cd, which defines the candela.
+// Exact, by definition of the SI.
+//
+// DO NOT follow this pattern to define your own units.  This is for library-defined units.
+// Instead, follow instructions at (https://aurora-opensource.github.io/au/main/howto/new-units/).
+template <typename T>
+struct LuminousEfficacyLabel {
+    static constexpr const char label[] = "K_cd";
+};
+template <typename T>
+constexpr const char LuminousEfficacyLabel<T>::label[];
+struct LuminousEfficacyUnit : decltype(Lumens{} / Watts{} * mag<683>()),
+                              LuminousEfficacyLabel<void> {
+    using LuminousEfficacyLabel<void>::label;
+};
+
+constexpr auto LUMINOUS_EFFICACY = make_constant(LuminousEfficacyUnit{});
+
+}  // namespace au
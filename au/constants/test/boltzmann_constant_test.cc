@@ -0,0 +1,30 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/boltzmann_constant.hh"
+
+#include "au/testing.hh"
+#include "au/units/joules.hh"
+#include "au/units/kelvins.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(BoltzmannConstant, HasExpectedLabel) { expect_label<BoltzmannConstantUnit>("k_B"); }
+
+TEST(BoltzmannConstant, HasExpectedValue) {
+    EXPECT_DOUBLE_EQ(BOLTZMANN_CONSTANT.in<double>(joules / kelvin), 1.380649e-23);
+}
+
+}  // namespace au
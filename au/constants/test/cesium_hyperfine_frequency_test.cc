@@ -0,0 +1,34 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/cesium_hyperfine_frequency.hh"
+
+#include <cstdint>
+
+#include "au/testing.hh"
+#include "au/units/hertz.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(CesiumHyperfineFrequency, HasExpectedLabel) {
+    expect_label<CesiumHyperfineFrequencyUnit>("Delta_nu_Cs");
+}
+
+TEST(CesiumHyperfineFrequency, HasExpectedValue) {
+    EXPECT_THAT(CESIUM_HYPERFINE_FREQUENCY.as<std::int64_t>(hertz),
+                SameTypeAndValue(hertz(std::int64_t{9'192'631'770})));
+}
+
+}  // namespace au
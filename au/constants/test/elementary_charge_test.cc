@@ -0,0 +1,29 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/elementary_charge.hh"
+
+#include "au/testing.hh"
+#include "au/units/coulombs.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(ElementaryCharge, HasExpectedLabel) { expect_label<ElementaryChargeUnit>("e"); }
+
+TEST(ElementaryCharge, HasExpectedValue) {
+    EXPECT_DOUBLE_EQ(ELEMENTARY_CHARGE.in<double>(coulombs), 1.602176634e-19);
+}
+
+}  // namespace au
@@ -0,0 +1,47 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/planck_constant.hh"
+
+#include "au/testing.hh"
+#include "au/units/hertz.hh"
+#include "au/units/joules.hh"
+#include "au/units/seconds.hh"
+#include "au/units/unos.hh"
+#include "gtest/gtest.h"
+
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+
+TEST(PlanckConstant, HasExpectedLabel) { expect_label<PlanckConstantUnit>("h"); }
+
+TEST(PlanckConstant, HasExpectedValue) {
+    EXPECT_DOUBLE_EQ(PLANCK_CONSTANT.in<double>(joule * seconds), 6.62607015e-34);
+}
+
+TEST(PlanckConstant, PhotonCountFoldsIntoSingleMagnitude) {
+    // The number of photons at 2 Hz, with a total energy of 8 h * Hz.  The constant's magnitude
+    // is applied once, when we convert the result, rather than once per operation.
+    const auto photons = joules(8.0 * 6.62607015e-34) / (PLANCK_CONSTANT * hertz(2.0));
+    EXPECT_DOUBLE_EQ(photons.in(unos), 4.0);
+
+    // The result's unit is a dimensionless unit whose magnitude is exactly `1 / h` (in SI units).
+    using PhotonUnit = decltype(photons)::Unit;
+    EXPECT_TRUE((HasSameDimension<PhotonUnit, Unos>::value));
+    StaticAssertTypeEq<UnitRatioT<PhotonUnit, Unos>,
+                       decltype(pow<42>(mag<10>()) / mag<662'607'015>())>();
+}
+
+}  // namespace au
@@ -0,0 +1,36 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/reduced_planck_constant.hh"
+
+#include "au/testing.hh"
+#include "au/units/joules.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(ReducedPlanckConstant, HasExpectedLabel) { expect_label<ReducedPlanckConstantUnit>("h_bar"); }
+
+TEST(ReducedPlanckConstant, HasExpectedValue) {
+    EXPECT_DOUBLE_EQ(REDUCED_PLANCK_CONSTANT.in<double>(joule * seconds),
+                     6.62607015e-34 / (2.0 * 3.14159265358979323846));
+}
+
+TEST(ReducedPlanckConstant, TwoPiTimesReducedPlanckIsExactlyPlanck) {
+    EXPECT_THAT((REDUCED_PLANCK_CONSTANT * mag<2>() * Magnitude<Pi>{}).as<int>(PLANCK_CONSTANT),
+                SameTypeAndValue(make_quantity<PlanckConstantUnit>(1)));
+}
+
+}  // namespace au
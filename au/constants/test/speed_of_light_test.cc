@@ -0,0 +1,39 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/speed_of_light.hh"
+
+#include <cstdint>
+
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(SpeedOfLight, HasExpectedLabel) { expect_label<SpeedOfLightUnit>("c"); }
+
+TEST(SpeedOfLight, HasExpectedValue) {
+    EXPECT_THAT(SPEED_OF_LIGHT.as<int>(meters / second),
+                SameTypeAndValue((meters / second)(299'792'458)));
+}
+
+TEST(SpeedOfLight, CancelsExactlyAtCompileTime) {
+    // Two light-seconds, expressed in meters, with no rounding.
+    EXPECT_THAT((seconds(std::int64_t{2}) * SPEED_OF_LIGHT).as(meters),
+                SameTypeAndValue(meters(std::int64_t{599'584'916})));
+}
+
+}  // namespace au
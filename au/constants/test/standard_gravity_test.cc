@@ -0,0 +1,30 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/constants/standard_gravity.hh"
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(StandardGravity, HasExpectedValue) {
+    EXPECT_THAT(STANDARD_GRAVITY.as<int>(micro(meters) / squared(second)),
+                SameTypeAndValue((micro(meters) / squared(second))(9'806'650)));
+}
+
+}  // namespace au
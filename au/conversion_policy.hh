@@ -17,6 +17,7 @@
 #include <limits>
 
 #include "au/magnitude.hh"
+#include "au/rep.hh"
 #include "au/stdx/type_traits.hh"
 #include "au/stdx/utility.hh"
 #include "au/unit_of_measure.hh"
@@ -51,13 +52,17 @@ struct CanScaleThresholdWithoutOverflow
 template <typename U1, typename U2>
 struct SameDimension : stdx::bool_constant<U1::dim_ == U2::dim_> {};
 
+// A complex rep follows the policy of its real part, except that we never implicitly drop the
+// imaginary part of a complex source.
 template <typename Rep, typename ScaleFactor, typename SourceRep>
 struct CoreImplicitConversionPolicyImpl
-    : stdx::disjunction<
-          std::is_floating_point<Rep>,
-          stdx::conjunction<std::is_integral<SourceRep>,
-                            IsInteger<ScaleFactor>,
-                            detail::CanScaleThresholdWithoutOverflow<Rep, ScaleFactor>>> {};
+    : stdx::conjunction<
+          stdx::disjunction<IsComplexRep<Rep>, stdx::negation<IsComplexRep<SourceRep>>>,
+          stdx::disjunction<
+              std::is_floating_point<RealPartT<Rep>>,
+              stdx::conjunction<std::is_integral<SourceRep>,
+                                IsInteger<ScaleFactor>,
+                                detail::CanScaleThresholdWithoutOverflow<Rep, ScaleFactor>>>> {};
 
 // Always permit the identity scaling.
 template <typename Rep>
@@ -0,0 +1,215 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "au/apply_magnitude.hh"
+#include "au/rep.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/stdx/utility.hh"
+#include "au/unit_of_measure.hh"
+
+// Opt-in runtime checks for data loss in unit conversions, for debug and test builds.
+//
+// The "forcing" conversions (`.coerce_as()`, `.coerce_in()`, and explicit-rep `.as<T>()` and
+// `.in<T>()`) skip Au's safety checks by design.  Compile _every_ translation unit with
+// `-DAU_ENABLE_CONVERSION_SANITIZER=1`, and each runtime `Quantity` or `QuantityPoint` conversion
+// also checks whether this particular value overflows or truncates, and calls the conversion loss
+// handler if it does.
+// The default handler prints a message and aborts; `set_conversion_loss_handler()` changes it.
+//
+// When the macro is not set (the default), this file adds no code to any conversion, and defines
+// nothing.
+
+#ifndef AU_ENABLE_CONVERSION_SANITIZER
+#define AU_ENABLE_CONVERSION_SANITIZER 0
+#endif
+
+#if AU_ENABLE_CONVERSION_SANITIZER
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#ifndef AU_STDX_HAS_IS_CONSTANT_EVALUATED
+#error "AU_ENABLE_CONVERSION_SANITIZER requires a compiler with __builtin_is_constant_evaluated()"
+#endif
+#endif
+
+namespace au {
+
+#if AU_ENABLE_CONVERSION_SANITIZER
+
+// The ways a conversion can lose data.
+enum class ConversionLossKind {
+    OVERFLOWS,
+    TRUNCATES,
+};
+
+// Everything we know about a conversion which lost data.
+struct ConversionLossReport {
+    ConversionLossKind kind;
+    const char *source_unit;
+    const char *target_unit;
+    const char *source_rep;
+    const char *target_rep;
+};
+
+using ConversionLossHandler = void (*)(const ConversionLossReport &);
+
+namespace detail {
+
+inline void abort_on_conversion_loss(const ConversionLossReport &report) {
+    std::fprintf(stderr,
+                 "Au conversion sanitizer: value %s when converting from %s [%s] to %s [%s]\n",
+                 (report.kind == ConversionLossKind::OVERFLOWS) ? "overflows" : "truncates",
+                 report.source_unit,
+                 report.source_rep,
+                 report.target_unit,
+                 report.target_rep);
+    std::abort();
+}
+
+inline std::atomic<ConversionLossHandler> &conversion_loss_handler() {
+    static std::atomic<ConversionLossHandler> handler{&abort_on_conversion_loss};
+    return handler;
+}
+
+}  // namespace detail
+
+// Call `handler` (instead of the default, which aborts) whenever a conversion loses data, and
+// return the previous handler.  Passing `nullptr` restores the default.
+//
+// If the handler returns, the conversion goes ahead, and gives the same result it would have given
+// without the sanitizer.
+inline ConversionLossHandler set_conversion_loss_handler(ConversionLossHandler handler) {
+    return detail::conversion_loss_handler().exchange(
+        handler ? handler : &detail::abort_on_conversion_loss);
+}
+
+namespace detail {
+
+// Whether `x` is infinite or NaN.  (Only floating point values can be.)
+template <typename T>
+constexpr bool is_non_finite(T x) {
+    return !(x - x == T{0});
+}
+
+// Whether `static_cast<T>(x)` overflows, or truncates, for arithmetic types `T` and `U`.
+//
+// We don't count the rounding which happens when converting to a floating point type as truncation:
+// floating point types are inexact by nature.
+
+template <typename T, typename U>
+constexpr bool static_cast_overflows(U x, std::true_type, std::true_type /* both integral */) {
+    return !stdx::in_range<T>(x);
+}
+template <typename T, typename U>
+constexpr bool static_cast_overflows(U x, std::true_type, std::false_type /* float to int */) {
+    // These bounds are powers of two, so `U` can represent them exactly.  NaN is never in range.
+    constexpr U upper = static_cast<U>(std::numeric_limits<T>::max() / 2 + 1) * U{2};
+    constexpr U lower = static_cast<U>(std::numeric_limits<T>::min());
+    return !((std::is_signed<T>::value ? (x >= lower) : (x > U{-1})) && (x < upper));
+}
+template <typename T, typename U>
+constexpr bool static_cast_overflows(U, std::false_type, std::true_type /* int to float */) {
+    return false;
+}
+template <typename T, typename U>
+constexpr bool static_cast_overflows(U x, std::false_type, std::false_type /* both float */) {
+    return !is_non_finite(x) && (x > static_cast<U>(std::numeric_limits<T>::max()) ||
+                                 x < static_cast<U>(std::numeric_limits<T>::lowest()));
+}
+template <typename T, typename U>
+constexpr bool static_cast_overflows(U x) {
+    return static_cast_overflows<T>(x, std::is_integral<T>{}, std::is_integral<U>{});
+}
+
+template <typename T, typename U>
+constexpr bool static_cast_truncates(U x) {
+    return std::is_integral<T>::value && std::is_floating_point<U>::value &&
+           static_cast<U>(static_cast<T>(x)) != x;
+}
+
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void report_conversion_loss(ConversionLossKind kind) {
+    conversion_loss_handler().load()(ConversionLossReport{kind,
+                                                          unit_label(FromUnit{}),
+                                                          unit_label(ToUnit{}),
+                                                          rep_label<FromRep>(),
+                                                          rep_label<ToRep>()});
+}
+
+// Check each step of the conversion in `Quantity::as<ToRep>()`: casting to the common rep,
+// applying the magnitude, and casting to the target rep.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_conversion_at_runtime(const FromRep &x, std::true_type /* reps are arithmetic */) {
+    using Common = std::common_type_t<FromRep, ToRep>;
+    using Apply = ApplyMagnitudeT<Common, UnitRatioT<FromUnit, ToUnit>>;
+    const auto report = &report_conversion_loss<FromUnit, FromRep, ToUnit, ToRep>;
+
+    if (static_cast_overflows<Common>(x)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const auto common = static_cast<Common>(x);
+
+    // Infinity and NaN pass through the magnitude unchanged: only the final cast can lose them.
+    if (!is_non_finite(common)) {
+        if (Apply::would_overflow(common)) {
+            return report(ConversionLossKind::OVERFLOWS);
+        }
+        if (Apply::would_truncate(common)) {
+            return report(ConversionLossKind::TRUNCATES);
+        }
+    }
+
+    const Common result = Apply{}(common);
+    if (static_cast_overflows<ToRep>(result)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    if (static_cast_truncates<ToRep>(result)) {
+        return report(ConversionLossKind::TRUNCATES);
+    }
+}
+
+// We only know how to check arithmetic reps.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_conversion_at_runtime(const FromRep &, std::false_type /* reps are arithmetic */) {}
+
+template <typename T>
+struct IsCheckableRep
+    : stdx::conjunction<std::is_arithmetic<T>, stdx::negation<std::is_same<T, bool>>> {};
+
+// Check the conversion of `x` from `Quantity<FromUnit, FromRep>` to `Quantity<ToUnit, ToRep>` for
+// overflow and truncation.
+//
+// This does nothing during constant evaluation, so it never changes what is `constexpr`.
+//
+// Callers must only call this when `AU_ENABLE_CONVERSION_SANITIZER` is set, so that disabled builds
+// don't get even an empty function (and its symbol and debug info) for every conversion.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+constexpr void check_conversion(const FromRep &x) {
+    if (!stdx::is_constant_evaluated()) {
+        check_conversion_at_runtime<FromUnit, FromRep, ToUnit, ToRep>(
+            x, stdx::conjunction<IsCheckableRep<FromRep>, IsCheckableRep<ToRep>>{});
+    }
+}
+
+}  // namespace detail
+
+#endif
+
+}  // namespace au
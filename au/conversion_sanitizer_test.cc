@@ -0,0 +1,171 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/conversion_sanitizer.hh"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/testing.hh"
+#include "au/units/celsius.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsEmpty;
+
+namespace au {
+namespace {
+
+// A summary of each conversion loss reported since the last `RecordConversionLosses` was created.
+std::vector<std::string> &losses() {
+    static std::vector<std::string> reports;
+    return reports;
+}
+
+void record(const ConversionLossReport &report) {
+    losses().push_back(std::string{report.kind == ConversionLossKind::OVERFLOWS ? "overflows"
+                                                                                  : "truncates"} +
+                       ": " + report.source_unit + " [" + report.source_rep + "] -> " +
+                       report.target_unit + " [" + report.target_rep + "]");
+}
+
+// Record losses (instead of aborting) for as long as this object exists.
+class RecordConversionLosses {
+ public:
+    RecordConversionLosses() : previous_{set_conversion_loss_handler(&record)} { losses().clear(); }
+    ~RecordConversionLosses() { set_conversion_loss_handler(previous_); }
+
+ private:
+    ConversionLossHandler previous_;
+};
+
+}  // namespace
+
+TEST(ConversionSanitizer, ReportsOverflowInCoerce) {
+    const RecordConversionLosses recorder;
+    (void)meters(int8_t{2}).coerce_in(centi(meters));
+    EXPECT_THAT(losses(), ElementsAre("overflows: m [int8_t] -> cm [int8_t]"));
+}
+
+TEST(ConversionSanitizer, ReportsTruncationInCoerce) {
+    const RecordConversionLosses recorder;
+    (void)inches(25).coerce_as(feet);
+    EXPECT_THAT(losses(), ElementsAre("truncates: in [int32_t] -> ft [int32_t]"));
+}
+
+TEST(ConversionSanitizer, DoesNotReportExactConversions) {
+    const RecordConversionLosses recorder;
+    EXPECT_THAT(inches(24).coerce_in(feet), Eq(2));
+    EXPECT_THAT(meters(int8_t{1}).coerce_in(centi(meters)), Eq(int8_t{100}));
+    EXPECT_THAT(meters(0.015).in<int>(milli(meters)), Eq(15));
+    EXPECT_THAT(losses(), IsEmpty());
+}
+
+TEST(ConversionSanitizer, ReportsNarrowingToExplicitRep) {
+    const RecordConversionLosses recorder;
+    (void)meters(300).as<uint8_t>(meters);
+    (void)meters(-1).in<uint32_t>(centi(meters));
+    EXPECT_THAT(losses(),
+                ElementsAre("overflows: m [int32_t] -> m [uint8_t]",
+                            "overflows: m [int32_t] -> cm [uint32_t]"));
+}
+
+TEST(ConversionSanitizer, ReportsFloatingPointToIntegerLoss) {
+    const RecordConversionLosses recorder;
+    (void)meters(0.0155).in<int32_t>(milli(meters));
+    (void)meters(1e10).in<int32_t>(meters);
+    (void)meters(std::numeric_limits<double>::quiet_NaN()).in<int64_t>(meters);
+    EXPECT_THAT(losses(),
+                ElementsAre("truncates: m [double] -> mm [int32_t]",
+                            "overflows: m [double] -> m [int32_t]",
+                            "overflows: m [double] -> m [int64_t]"));
+}
+
+TEST(ConversionSanitizer, ReportsFloatingPointOverflow) {
+    const RecordConversionLosses recorder;
+    (void)meters(1e300).in<float>(meters);
+    (void)meters(1e30f).in<float>(nano(meters));
+    EXPECT_THAT(meters(std::numeric_limits<double>::infinity()).in<float>(meters),
+                Eq(std::numeric_limits<float>::infinity()));
+    EXPECT_THAT(losses(),
+                ElementsAre("overflows: m [double] -> m [float]",
+                            "overflows: m [float] -> nm [float]"));
+}
+
+TEST(ConversionSanitizer, ChecksImplicitConversionsToo) {
+    const RecordConversionLosses recorder;
+    (void)meters(30'000'000).in(centi(meters));
+    EXPECT_THAT(losses(), ElementsAre("overflows: m [int32_t] -> cm [int32_t]"));
+}
+
+TEST(ConversionSanitizer, ChecksQuantityPointConversions) {
+    const RecordConversionLosses recorder;
+    (void)kelvins_pt(int16_t{400}).coerce_as(centi(kelvins_pt));
+    (void)celsius_pt(20).coerce_in(kelvins_pt);
+    (void)celsius_pt(20.5).in<int32_t>(kelvins_pt);
+    EXPECT_THAT(losses(),
+                ElementsAre("overflows: K [int16_t] -> cK [int16_t]",
+                            "truncates: degC [int32_t] -> K [int32_t]",
+                            "truncates: degC [double] -> K [int32_t]"));
+}
+
+TEST(ConversionSanitizer, DoesNotReportExactQuantityPointConversions) {
+    const RecordConversionLosses recorder;
+    EXPECT_THAT(kelvins_pt(int16_t{300}).coerce_in(centi(kelvins_pt)), Eq(int16_t{30'000}));
+    EXPECT_THAT(celsius_pt(-40).coerce_in(centi(kelvins_pt)), Eq(23'315));
+    EXPECT_THAT(celsius_pt(20.0).in<int32_t>(centi(kelvins_pt)), Eq(29'315));
+    EXPECT_THAT(losses(), IsEmpty());
+}
+
+TEST(ConversionSanitizer, ChecksCoercePoints) {
+    const RecordConversionLosses recorder;
+    const QuantityPoint<Kelvins, int16_t> from[] = {kelvins_pt(int16_t{1}), kelvins_pt(int16_t{400})};
+    QuantityPoint<Centi<Kelvins>, int16_t> to[2];
+    coerce_points(stdx::make_span(from), stdx::make_span(to));
+    EXPECT_THAT(losses(), ElementsAre("overflows: K [int16_t] -> cK [int16_t]"));
+}
+
+TEST(ConversionSanitizer, ConversionGoesAheadIfHandlerReturns) {
+    const RecordConversionLosses recorder;
+    EXPECT_THAT(inches(25).coerce_as(feet), SameTypeAndValue(feet(2)));
+}
+
+TEST(ConversionSanitizer, DoesNotAffectConstantEvaluation) {
+    const RecordConversionLosses recorder;
+    constexpr auto length = inches(25).coerce_as(feet);
+    static_assert(length == feet(2), "Conversion must still be constexpr");
+    EXPECT_THAT(losses(), IsEmpty());
+}
+
+TEST(ConversionSanitizer, SetHandlerReturnsPreviousHandler) {
+    const RecordConversionLosses recorder;
+    EXPECT_THAT(set_conversion_loss_handler(&record), Eq(&record));
+}
+
+TEST(ConversionSanitizerDeathTest, AbortsByDefault) {
+    EXPECT_DEATH((void)meters(int8_t{2}).coerce_in(centi(meters)),
+                 "overflows when converting from m \\[int8_t\\] to cm \\[int8_t\\]");
+}
+
+}  // namespace au
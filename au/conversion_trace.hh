@@ -0,0 +1,223 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/rep.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/unit_of_measure.hh"
+
+// Opt-in tracing of unit conversions, for finding conversions which are hot or redundant.
+//
+// Compile _every_ translation unit with `-DAU_ENABLE_CONVERSION_TRACING=1` to count each runtime
+// conversion of a `Quantity` or `QuantityPoint` (whether through `.as()`, `.in()`, the `coerce_`
+// variants, or implicit construction).  The counts are keyed by source unit label, target unit
+// label, and rep.  Use `conversion_trace_snapshot()` or `print_conversion_trace()` to read them.
+//
+// When the macro is not set (the default), this file adds no code to any conversion, and defines
+// nothing.
+
+#ifndef AU_ENABLE_CONVERSION_TRACING
+#define AU_ENABLE_CONVERSION_TRACING 0
+#endif
+
+#if AU_ENABLE_CONVERSION_TRACING
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef AU_STDX_HAS_IS_CONSTANT_EVALUATED
+#error "AU_ENABLE_CONVERSION_TRACING requires a compiler with __builtin_is_constant_evaluated()"
+#endif
+#endif
+
+namespace au {
+
+#if AU_ENABLE_CONVERSION_TRACING
+
+// How many times a particular conversion was performed.
+struct ConversionTraceEntry {
+    const char *source_unit;
+    const char *target_unit;
+
+    // The rep, such as `"int32_t"`; or, if the conversion changes the rep, both reps, such as
+    // `"int32_t -> double"`.
+    std::string rep;
+
+    std::uint64_t count;
+};
+
+namespace detail {
+
+// The most distinct conversions (that is, distinct source unit, target unit, and reps) we can
+// track.  Any beyond this are counted together, under the label "[OTHER CONVERSIONS]".
+constexpr std::size_t MAX_TRACED_CONVERSIONS = 4096u;
+
+// Everything we know about one distinct conversion, apart from its counts.
+struct ConversionTraceSite {
+    const char *source_unit;
+    const char *target_unit;
+    const char *source_rep;
+    const char *target_rep;
+};
+
+// The counts for a single thread.  Only that thread writes them, so the atomics are never
+// contended; they just let other threads read the counts safely.
+struct ConversionTraceTable {
+    std::array<std::atomic<std::uint64_t>, MAX_TRACED_CONVERSIONS + 1u> counts{};
+};
+
+struct ConversionTraceRegistry {
+    std::atomic<std::size_t> num_sites{0u};
+    std::array<std::atomic<const ConversionTraceSite *>, MAX_TRACED_CONVERSIONS> sites{};
+
+    // Guards `tables`.  We only take it the first time each thread converts, and when reporting.
+    std::mutex mutex;
+
+    // Tables are never destroyed, so that counts outlive the threads which made them.
+    std::vector<std::unique_ptr<ConversionTraceTable>> tables;
+};
+
+inline ConversionTraceRegistry &conversion_trace_registry() {
+    static ConversionTraceRegistry registry;
+    return registry;
+}
+
+inline std::size_t register_conversion_trace_site(const ConversionTraceSite &site) {
+    auto &registry = conversion_trace_registry();
+    const auto index = registry.num_sites.fetch_add(1u, std::memory_order_relaxed);
+    if (index >= MAX_TRACED_CONVERSIONS) {
+        return MAX_TRACED_CONVERSIONS;
+    }
+    registry.sites[index].store(&site, std::memory_order_release);
+    return index;
+}
+
+inline ConversionTraceTable &this_thread_conversion_trace_table() {
+    thread_local ConversionTraceTable *const table = [] {
+        auto &registry = conversion_trace_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.tables.push_back(std::make_unique<ConversionTraceTable>());
+        return registry.tables.back().get();
+    }();
+    return *table;
+}
+
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void record_conversion_at_runtime() {
+    static const ConversionTraceSite site{
+        unit_label(FromUnit{}), unit_label(ToUnit{}), rep_label<FromRep>(), rep_label<ToRep>()};
+    static const std::size_t index = register_conversion_trace_site(site);
+    this_thread_conversion_trace_table().counts[index].fetch_add(1u, std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+// The total count of every conversion performed so far, by every thread, most frequent first.
+//
+// Each count is read atomically, but the snapshot as a whole is not atomic with respect to
+// conversions happening concurrently.
+inline std::vector<ConversionTraceEntry> conversion_trace_snapshot() {
+    auto &registry = detail::conversion_trace_registry();
+
+    std::array<std::uint64_t, detail::MAX_TRACED_CONVERSIONS + 1u> totals{};
+    {
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        for (const auto &table : registry.tables) {
+            for (std::size_t i = 0u; i < totals.size(); ++i) {
+                totals[i] += table->counts[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<ConversionTraceEntry> entries;
+    for (std::size_t i = 0u; i < detail::MAX_TRACED_CONVERSIONS; ++i) {
+        const auto *site = registry.sites[i].load(std::memory_order_acquire);
+        if (totals[i] == 0u || site == nullptr) {
+            continue;
+        }
+        std::string rep = site->source_rep;
+        if (rep != site->target_rep) {
+            rep = rep + " -> " + site->target_rep;
+        }
+        entries.push_back({site->source_unit, site->target_unit, std::move(rep), totals[i]});
+    }
+    if (totals.back() > 0u) {
+        entries.push_back(
+            {"[OTHER CONVERSIONS]", "[OTHER CONVERSIONS]", "", totals.back()});
+    }
+
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const ConversionTraceEntry &a, const ConversionTraceEntry &b) {
+                         return a.count > b.count;
+                     });
+    return entries;
+}
+
+// Set every count back to zero.
+//
+// Conversions which happen concurrently with this call may or may not be counted afterwards.
+inline void reset_conversion_trace() {
+    auto &registry = detail::conversion_trace_registry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    for (const auto &table : registry.tables) {
+        for (auto &count : table->counts) {
+            count.store(0u, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Print the result of `conversion_trace_snapshot()`, one conversion per line.
+//
+// For example: `1204  ms -> s  [int64_t -> double]`.
+inline void print_conversion_trace(std::ostream &out) {
+    for (const auto &entry : conversion_trace_snapshot()) {
+        out << entry.count << "  " << entry.source_unit << " -> " << entry.target_unit << "  ["
+            << entry.rep << "]\n";
+    }
+}
+
+namespace detail {
+
+// Record a conversion from `Quantity<FromUnit, FromRep>` to `Quantity<ToUnit, ToRep>` (or the
+// corresponding `QuantityPoint` types).
+//
+// This does nothing during constant evaluation, so it never changes what is `constexpr`.  Nor does
+// it record "conversions" to the very same type, which don't do anything.
+//
+// Callers must only call this when `AU_ENABLE_CONVERSION_TRACING` is set, so that disabled builds
+// don't get even an empty function (and its symbol and debug info) for every conversion.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+constexpr void trace_conversion() {
+    constexpr bool IS_NO_OP =
+        std::is_same<FromUnit, ToUnit>::value && std::is_same<FromRep, ToRep>::value;
+    if (!IS_NO_OP && !stdx::is_constant_evaluated()) {
+        record_conversion_at_runtime<FromUnit, FromRep, ToUnit, ToRep>();
+    }
+}
+
+}  // namespace detail
+
+#endif
+
+}  // namespace au
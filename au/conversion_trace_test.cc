@@ -0,0 +1,160 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/conversion_trace.hh"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/testing.hh"
+#include "au/units/celsius.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "gtest/gtest.h"
+
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::StrEq;
+
+namespace au {
+namespace {
+
+// The count for the conversion with the given labels, or 0 if there is none.
+std::uint64_t count_for(const std::vector<ConversionTraceEntry> &entries,
+                        const std::string &source_unit,
+                        const std::string &target_unit,
+                        const std::string &rep) {
+    for (const auto &entry : entries) {
+        if (entry.source_unit == source_unit && entry.target_unit == target_unit &&
+            entry.rep == rep) {
+            return entry.count;
+        }
+    }
+    return 0u;
+}
+
+}  // namespace
+
+TEST(ConversionTrace, CountsEachRuntimeConversion) {
+    reset_conversion_trace();
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_THAT(feet(i).in(inches), Eq(12 * i));
+    }
+    EXPECT_THAT(meters(1).as(centi(meters)), SameTypeAndValue(centi(meters)(100)));
+
+    const auto entries = conversion_trace_snapshot();
+    EXPECT_THAT(count_for(entries, "ft", "in", "int32_t"), Eq(3u));
+    EXPECT_THAT(count_for(entries, "m", "cm", "int32_t"), Eq(1u));
+}
+
+TEST(ConversionTrace, SortsMostFrequentFirst) {
+    reset_conversion_trace();
+
+    for (int i = 0; i < 5; ++i) {
+        (void)meters(i).in(centi(meters));
+    }
+    (void)feet(1).in(inches);
+
+    const auto entries = conversion_trace_snapshot();
+    ASSERT_THAT(entries.size(), Eq(2u));
+    EXPECT_THAT(entries[0].target_unit, StrEq("cm"));
+    EXPECT_THAT(entries[1].target_unit, StrEq("in"));
+}
+
+TEST(ConversionTrace, CountsCoercionsAndImplicitConversions) {
+    reset_conversion_trace();
+
+    (void)inches(int64_t{25}).coerce_in(feet);
+    const QuantityI64<Inches> implicitly_converted = feet(int64_t{2});
+    EXPECT_THAT(implicitly_converted, SameTypeAndValue(inches(int64_t{24})));
+
+    const auto entries = conversion_trace_snapshot();
+    EXPECT_THAT(count_for(entries, "in", "ft", "int64_t"), Eq(1u));
+    EXPECT_THAT(count_for(entries, "ft", "in", "int64_t"), Eq(1u));
+}
+
+TEST(ConversionTrace, ShowsBothRepsWhenRepChanges) {
+    reset_conversion_trace();
+
+    (void)meters(2).in<double>(centi(meters));
+
+    EXPECT_THAT(count_for(conversion_trace_snapshot(), "m", "cm", "int32_t -> double"), Eq(1u));
+}
+
+TEST(ConversionTrace, CountsQuantityPointConversions) {
+    reset_conversion_trace();
+
+    EXPECT_THAT(celsius_pt(20).in(milli(kelvins_pt)), Eq(293'150));
+
+    EXPECT_THAT(count_for(conversion_trace_snapshot(), "degC", "mK", "int32_t"), Eq(1u));
+}
+
+TEST(ConversionTrace, DoesNotCountConversionsWhichAreNotNeeded) {
+    reset_conversion_trace();
+
+    EXPECT_THAT(meters(3).in(meters), Eq(3));
+    EXPECT_THAT(meters(3).as(meters), SameTypeAndValue(meters(3)));
+    EXPECT_THAT(celsius_pt(3).in(celsius_pt), Eq(3));
+
+    EXPECT_THAT(conversion_trace_snapshot(), IsEmpty());
+}
+
+TEST(ConversionTrace, DoesNotAffectConstantEvaluation) {
+    reset_conversion_trace();
+
+    constexpr auto length = feet(2).as(inches);
+    static_assert(length == inches(24), "Conversion must still be constexpr");
+
+    EXPECT_THAT(conversion_trace_snapshot(), IsEmpty());
+}
+
+TEST(ConversionTrace, MergesCountsFromAllThreads) {
+    reset_conversion_trace();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1'000; ++i) {
+                (void)meters(i).in(centi(meters));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_THAT(count_for(conversion_trace_snapshot(), "m", "cm", "int32_t"), Eq(4'000u));
+}
+
+TEST(ConversionTrace, PrintsOneLinePerConversion) {
+    reset_conversion_trace();
+
+    (void)feet(1).in(inches);
+    (void)feet(2).in(inches);
+
+    std::ostringstream out;
+    print_conversion_trace(out);
+    EXPECT_THAT(out.str(), StrEq("2  ft -> in  [int32_t]\n"));
+}
+
+}  // namespace au
@@ -0,0 +1,27 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// The core of the library: quantities, quantity points, units, prefixes, and constants.
+//
+// This depends on only a handful of small standard library headers.  In particular, it does _not_
+// include `<chrono>`, `<cmath>`, `<functional>`, or `<ostream>`: get those integrations from
+// `"au/chrono_interop.hh"`, `"au/math.hh"`, `"au/hash.hh"`, and `"au/io.hh"`, respectively (or
+// from `"au/au.hh"`, which includes all but the last).
+
+#include "au/constant.hh"
+#include "au/prefix.hh"
+#include "au/quantity_point.hh"
+#include "au/quantity_span.hh"
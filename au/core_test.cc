@@ -0,0 +1,51 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/core.hh"
+
+// Check that the core stays "header-light".  We can only detect this for standard libraries whose
+// include guards we know, so this check runs on libstdc++ alone.  It has to come before any other
+// include, because the test framework itself pulls in many of these headers.
+#if defined(__GLIBCXX__)
+#if defined(_GLIBCXX_CHRONO) || defined(_GLIBCXX_CMATH) || defined(_GLIBCXX_FUNCTIONAL) || \
+    defined(_GLIBCXX_OSTREAM) || defined(_GLIBCXX_COMPLEX) || defined(_GLIBCXX_ALGORITHM)
+#error "au/core.hh must not include <chrono>, <cmath>, <functional>, <ostream>, or <algorithm>"
+#endif
+#endif
+
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(Core, SupportsQuantitiesPointsPrefixesAndConstants) {
+    EXPECT_EQ(kilo(meters)(1.5).in(meters), 1'500.0);
+    EXPECT_EQ(meters_pt(3) - meters_pt(1), meters(2));
+    EXPECT_EQ((make_constant(meters / second) * seconds(2)).in(meters), 2);
+}
+
+TEST(Core, ZeroConvertsToChronoDurationWithoutIncludingChrono) {
+    struct FakeDuration {
+        using rep = int;
+        using period = std::ratio<1>;
+        constexpr explicit FakeDuration(int c) : count{c} {}
+        int count;
+    };
+    constexpr FakeDuration d = ZERO;
+    EXPECT_EQ(d.count, 0);
+}
+
+}  // namespace au
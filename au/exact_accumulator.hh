@@ -0,0 +1,116 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "au/apply_magnitude.hh"
+#include "au/quantity.hh"
+#include "au/stdx/utility.hh"
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+// `ExactAccumulator<Units...>`: an exact, overflow-checked running total of quantities.
+//
+// The total is stored as a `std::intmax_t` in `CommonUnitT<Units...>`: the largest unit which
+// evenly divides all of the listed units.  Since this is computed at compile time, adding any
+// quantity whose unit is an integer multiple of that common unit is a single integer multiply-add,
+// with no rounding.  (The listed units are only used to compute the common unit: `add()` accepts
+// quantities in _any_ unit which the common unit evenly divides.)
+//
+// For example, `ExactAccumulator<Seconds, Milli<Seconds>, RtpTicks>`, where `RtpTicks` is 1/90000 of
+// a second, accumulates in units of 1/90000 second, and can add all three kinds of durations (as
+// well as minutes, hours, and so on) with no drift at all.
+//
+// If an addition would overflow, `add()` returns `false` and leaves the total unchanged; the
+// accumulator also remembers that this happened, so that it can be checked once at the end.
+template <typename... Units>
+class ExactAccumulator {
+ public:
+    using Unit = CommonUnitT<Units...>;
+    using Rep = std::intmax_t;
+
+    // Add `q` to the total, returning `true` on success, and `false` (with no change) on overflow.
+    template <typename U, typename R>
+    bool add(Quantity<U, R> q) {
+        return accumulate(q, false);
+    }
+
+    // Subtract `q` from the total, returning `true` on success, and `false` (with no change) on
+    // overflow.
+    template <typename U, typename R>
+    bool subtract(Quantity<U, R> q) {
+        return accumulate(q, true);
+    }
+
+    // The exact total of everything successfully added so far.
+    constexpr Quantity<Unit, Rep> total() const { return make_quantity<Unit>(total_); }
+
+    // Whether any `add()` or `subtract()` has failed due to overflow.
+    constexpr bool has_overflowed() const { return has_overflowed_; }
+
+ private:
+    template <typename U, typename R>
+    bool accumulate(Quantity<U, R> q, bool negate) {
+        static_assert(std::is_integral<R>::value,
+                      "ExactAccumulator only accepts integral Rep; floating point is not exact");
+        using Ratio = UnitRatioT<U, Unit>;
+        static_assert(IsInteger<Ratio>::value,
+                      "Unit must be an integer multiple of the accumulator's unit");
+
+        const R value = q.in(U{});
+        if (!stdx::in_range<Rep>(value)) {
+            return fail();
+        }
+        Rep x = static_cast<Rep>(value);
+
+        if (detail::ApplyMagnitudeT<Rep, Ratio>::would_overflow(x)) {
+            return fail();
+        }
+        x = detail::apply_magnitude(x, Ratio{});
+
+        if (negate) {
+            // Negating the most negative value would overflow.
+            if (x == std::numeric_limits<Rep>::lowest()) {
+                return fail();
+            }
+            x = -x;
+        }
+
+        if (would_sum_overflow(total_, x)) {
+            return fail();
+        }
+        total_ += x;
+        return true;
+    }
+
+    bool fail() {
+        has_overflowed_ = true;
+        return false;
+    }
+
+    static constexpr bool would_sum_overflow(Rep a, Rep b) {
+        return (b > 0) ? (a > std::numeric_limits<Rep>::max() - b)
+                       : (a < std::numeric_limits<Rep>::lowest() - b);
+    }
+
+    Rep total_ = 0;
+    bool has_overflowed_ = false;
+};
+
+}  // namespace au
@@ -0,0 +1,107 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/exact_accumulator.hh"
+
+#include <cstdint>
+#include <limits>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/bits.hh"
+#include "au/units/bytes.hh"
+#include "au/units/minutes.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+
+struct RtpTicks : decltype(Seconds{} / mag<90'000>()) {};
+constexpr auto rtp_ticks = QuantityMaker<RtpTicks>{};
+
+TEST(ExactAccumulator, AccumulatesInCommonUnitOfListedUnits) {
+    StaticAssertTypeEq<ExactAccumulator<Seconds, Milli<Seconds>>::Unit, Milli<Seconds>>();
+    using RtpAccumulator = ExactAccumulator<Seconds, Milli<Seconds>, RtpTicks>;
+    EXPECT_TRUE((AreUnitsQuantityEquivalent<RtpAccumulator::Unit, RtpTicks>::value));
+}
+
+TEST(ExactAccumulator, StartsAtZero) {
+    const ExactAccumulator<Bytes> acc{};
+    EXPECT_EQ(acc.total(), ZERO);
+    EXPECT_FALSE(acc.has_overflowed());
+}
+
+TEST(ExactAccumulator, SumsMixedUnitsExactly) {
+    ExactAccumulator<Seconds, Milli<Seconds>, RtpTicks> acc{};
+    EXPECT_TRUE(acc.add(seconds(1)));
+    EXPECT_TRUE(acc.add(milli(seconds)(int64_t{250})));
+    EXPECT_TRUE(acc.add(rtp_ticks(uint32_t{3})));
+    EXPECT_TRUE(acc.add(minutes(int16_t{2})));
+
+    EXPECT_THAT(acc.total(), QuantityEquivalent(rtp_ticks(std::intmax_t{10'912'503})));
+}
+
+TEST(ExactAccumulator, RepeatedSmallAdditionsDoNotDrift) {
+    ExactAccumulator<Seconds, RtpTicks> acc{};
+    for (int i = 0; i < 90'000; ++i) {
+        acc.add(rtp_ticks(1));
+    }
+    EXPECT_EQ(acc.total(), seconds(1));
+}
+
+TEST(ExactAccumulator, CanSubtract) {
+    ExactAccumulator<Bits, Bytes> acc{};
+    acc.add(bytes(3));
+    EXPECT_TRUE(acc.subtract(bits(5)));
+    EXPECT_THAT(acc.total(), SameTypeAndValue(bits(std::intmax_t{19})));
+}
+
+TEST(ExactAccumulator, ReportsOverflowAndLeavesTotalUnchanged) {
+    constexpr auto max = std::numeric_limits<std::intmax_t>::max();
+    ExactAccumulator<Milli<Seconds>> acc{};
+
+    EXPECT_TRUE(acc.add(milli(seconds)(max - 1)));
+    EXPECT_FALSE(acc.has_overflowed());
+
+    EXPECT_FALSE(acc.add(milli(seconds)(2)));
+    EXPECT_TRUE(acc.has_overflowed());
+    EXPECT_EQ(acc.total(), milli(seconds)(max - 1));
+
+    // The overflow flag is sticky, even after subsequent successful additions.
+    EXPECT_TRUE(acc.add(milli(seconds)(1)));
+    EXPECT_TRUE(acc.has_overflowed());
+}
+
+TEST(ExactAccumulator, ReportsOverflowInUnitConversion) {
+    ExactAccumulator<Milli<Seconds>> acc{};
+    EXPECT_FALSE(acc.add(seconds(std::numeric_limits<std::intmax_t>::max() / 100)));
+    EXPECT_EQ(acc.total(), ZERO);
+}
+
+TEST(ExactAccumulator, ReportsOverflowWhenSubtractingLowestValue) {
+    ExactAccumulator<Seconds> acc{};
+    EXPECT_FALSE(acc.subtract(seconds(std::numeric_limits<std::intmax_t>::lowest())));
+    EXPECT_TRUE(acc.has_overflowed());
+    EXPECT_EQ(acc.total(), ZERO);
+}
+
+TEST(ExactAccumulator, ReportsOverflowForUnsignedValuesOutOfRange) {
+    ExactAccumulator<Bytes> acc{};
+    EXPECT_FALSE(acc.add(bytes(std::numeric_limits<std::uintmax_t>::max())));
+    EXPECT_EQ(acc.total(), ZERO);
+}
+
+}  // namespace au
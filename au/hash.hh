@@ -0,0 +1,89 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+
+// Hashing support for `Quantity` and `QuantityPoint`.
+//
+// This lives in its own header, rather than in `quantity.hh`, because `<functional>` is moderately
+// expensive to include, and most files which use quantities never hash them.
+
+namespace au {
+
+// Hash the value of `q` after converting it to `target_unit`.
+//
+// Use this to build hashers which give the same hash to equal quantities in different units: for
+// example, `hash_in(meters, q)` is the same for `meters(1'000)` and `kilo(meters)(1)`.  The
+// conversion has the same safety checks as `q.in(target_unit)`.  To get the same hash for
+// different Rep types too, pass the Rep explicitly, as in `hash_in<int64_t>(meters, q)`.
+template <typename TargetUnit,
+          typename U,
+          typename R,
+          typename = std::enable_if_t<IsUnit<AssociatedUnitT<TargetUnit>>::value>>
+std::size_t hash_in(TargetUnit target_unit, Quantity<U, R> q) {
+    return std::hash<R>{}(q.in(target_unit));
+}
+template <typename T,
+          typename TargetUnit,
+          typename U,
+          typename R,
+          typename = std::enable_if_t<IsUnit<AssociatedUnitT<TargetUnit>>::value>>
+std::size_t hash_in(TargetUnit target_unit, Quantity<U, R> q) {
+    return std::hash<T>{}(q.template in<T>(target_unit));
+}
+
+// Hash the value of `p` after converting it to `target_unit` (see the `Quantity` overload).
+template <typename TargetUnit,
+          typename U,
+          typename R,
+          typename = std::enable_if_t<IsUnit<AssociatedUnitForPointsT<TargetUnit>>::value>>
+std::size_t hash_in(TargetUnit target_unit, QuantityPoint<U, R> p) {
+    return std::hash<R>{}(p.in(target_unit));
+}
+template <typename T,
+          typename TargetUnit,
+          typename U,
+          typename R,
+          typename = std::enable_if_t<IsUnit<AssociatedUnitForPointsT<TargetUnit>>::value>>
+std::size_t hash_in(TargetUnit target_unit, QuantityPoint<U, R> p) {
+    return std::hash<T>{}(p.template in<T>(target_unit));
+}
+
+}  // namespace au
+
+namespace std {
+// See the note in `quantity.hh` about reopening `namespace std`.
+
+// Hash a `Quantity` by hashing its underlying value.  Equal quantities of the same type always have
+// equal hashes; use `au::hash_in()` to hash quantities of different units consistently.
+template <typename U, typename R>
+struct hash<au::Quantity<U, R>> {
+    std::size_t operator()(const au::Quantity<U, R> &q) const {
+        return hash<R>{}(q.in(typename au::Quantity<U, R>::Unit{}));
+    }
+};
+
+template <typename U, typename R>
+struct hash<au::QuantityPoint<U, R>> {
+    std::size_t operator()(const au::QuantityPoint<U, R> &p) const {
+        return hash<R>{}(p.in(typename au::QuantityPoint<U, R>::Unit{}));
+    }
+};
+}  // namespace std
@@ -0,0 +1,69 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/hash.hh"
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "au/prefix.hh"
+#include "au/units/celsius.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/yards.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(Quantity, StdHashHashesUnderlyingValue) {
+    EXPECT_EQ(std::hash<QuantityI32<Feet>>{}(feet(3)), std::hash<int>{}(3));
+    EXPECT_EQ(std::hash<QuantityD<Feet>>{}(feet(1.5)), std::hash<double>{}(1.5));
+}
+
+TEST(Quantity, CanBeUnorderedMapKey) {
+    std::unordered_map<QuantityI32<Feet>, int> m;
+    m[feet(3)] = 1;
+    m[yards(2)] = 2;
+    EXPECT_EQ(m.at(feet(3)), 1);
+    EXPECT_EQ(m.at(feet(6)), 2);
+    EXPECT_EQ(m.count(feet(4)), 0u);
+}
+
+TEST(QuantityPoint, StdHashHashesUnderlyingValue) {
+    EXPECT_EQ(std::hash<QuantityPointI32<Celsius>>{}(celsius_pt(20)), std::hash<int>{}(20));
+
+    const std::unordered_set<QuantityPointI32<Celsius>> temps{celsius_pt(20), celsius_pt(25)};
+    EXPECT_EQ(temps.count(celsius_pt(20)), 1u);
+    EXPECT_EQ(temps.count(celsius_pt(21)), 0u);
+}
+
+TEST(HashIn, GivesSameHashForEqualQuantitiesInDifferentUnits) {
+    EXPECT_EQ(hash_in(inches, feet(2)), hash_in(inches, inches(24)));
+    EXPECT_EQ(hash_in(inches, yards(1)), std::hash<int>{}(36));
+}
+
+TEST(HashIn, CanHashInExplicitRep) {
+    EXPECT_EQ(hash_in<std::int64_t>(inches, feet(2)), hash_in<std::int64_t>(inches, inches(24ll)));
+    EXPECT_EQ(hash_in<int>(feet, inches(30)), std::hash<int>{}(2));
+}
+
+TEST(HashIn, HashesPointsAfterConversion) {
+    EXPECT_EQ(hash_in(milli(kelvins_pt), celsius_pt(0)),
+              hash_in(milli(kelvins_pt), milli(kelvins_pt)(273'150)));
+    EXPECT_EQ(hash_in<double>(kelvins_pt, milli(kelvins_pt)(273'000)), std::hash<double>{}(273.0));
+}
+
+}  // namespace au
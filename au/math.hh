@@ -16,12 +16,17 @@
 
 #include <algorithm>
 #include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 
 #include "au/constant.hh"
 #include "au/quantity.hh"
 #include "au/quantity_point.hh"
+#include "au/units/bam16.hh"
+#include "au/units/bam32.hh"
 #include "au/units/radians.hh"
 
 namespace au {
@@ -30,12 +35,17 @@ namespace au {
 // Lookup will stop once it hits `::au::sin()`, hiding the `::sin()` overload in the global
 // namespace.  To learn more about Name Lookup, see this article (https://abseil.io/tips/49).
 using std::abs;
+using std::arg;
+using std::conj;
 using std::copysign;
 using std::cos;
 using std::fmod;
+using std::imag;
 using std::isnan;
 using std::max;
 using std::min;
+using std::norm;
+using std::real;
 using std::remainder;
 using std::sin;
 using std::sqrt;
@@ -113,6 +123,116 @@ struct RoundingRep<Quantity<U, R>, RoundingUnits> {
 template <typename U, typename R, typename RoundingUnits>
 struct RoundingRep<QuantityPoint<U, R>, RoundingUnits>
     : RoundingRep<Quantity<U, R>, RoundingUnits> {};
+
+//
+// Table-driven `sin()` and `cos()` for binary angles (such as `Bam16` and `Bam32`), which hold one
+// revolution in an unsigned integer type.
+//
+// The table holds the sine at `2^Bits` evenly spaced angles around one revolution, plus a final
+// entry equal to the first, so that every entry has a successor to interpolate towards.  We index
+// it directly with the high bits of the angle, and interpolate linearly with the low bits.
+//
+constexpr int BINARY_ANGLE_SINE_TABLE_BITS = 10;
+
+// The sine of `k / n` revolutions, for `0 <= k <= n`, where `n` is a multiple of 4.
+//
+// This is only for building the table at compile time.  We reduce the angle exactly, using integer
+// symmetries, to within a quarter revolution of zero, where its Taylor series converges quickly.
+constexpr double sin_of_revolution_fraction(std::int64_t k, std::int64_t n) {
+    if (2 * k > n) {
+        k -= n;
+    }
+    if (4 * k > n) {
+        k = n / 2 - k;
+    }
+    if (4 * k < -n) {
+        k = -n / 2 - k;
+    }
+
+    const double x =
+        2.0 * 3.14159265358979323846 * static_cast<double>(k) / static_cast<double>(n);
+    double term = x;
+    double sum = 0.0;
+    for (int i = 1; i < 40; i += 2) {
+        sum += term;
+        term *= -x * x / static_cast<double>((i + 1) * (i + 2));
+    }
+    return sum;
+}
+
+template <int Bits>
+struct SineTable {
+    static constexpr std::size_t SIZE = (std::size_t{1} << Bits) + 1u;
+
+    constexpr SineTable() : values{} {
+        for (std::size_t i = 0u; i < SIZE; ++i) {
+            values[i] = static_cast<float>(sin_of_revolution_fraction(
+                static_cast<std::int64_t>(i), static_cast<std::int64_t>(SIZE - 1u)));
+        }
+    }
+
+    float values[SIZE];
+};
+
+template <int Bits>
+struct SineTableFor {
+    static constexpr SineTable<Bits> value{};
+};
+template <int Bits>
+constexpr SineTable<Bits> SineTableFor<Bits>::value;
+
+// The sine of `count / 2^N` revolutions, where `UInt` is an unsigned type with `N` bits.
+template <typename UInt>
+float binary_angle_sin(UInt count) {
+    constexpr int SHIFT = std::numeric_limits<UInt>::digits - BINARY_ANGLE_SINE_TABLE_BITS;
+    constexpr auto &table = SineTableFor<BINARY_ANGLE_SINE_TABLE_BITS>::value.values;
+
+    const auto index = static_cast<std::size_t>(count >> SHIFT);
+    const auto low_bits = count & ((UInt{1} << SHIFT) - 1u);
+    const float fraction =
+        static_cast<float>(low_bits) * (1.0f / static_cast<float>(UInt{1} << SHIFT));
+    return table[index] + fraction * (table[index + 1u] - table[index]);
+}
+
+// The cosine of `count / 2^N` revolutions, where `UInt` is an unsigned type with `N` bits.
+template <typename UInt>
+float binary_angle_cos(UInt count) {
+    constexpr UInt QUARTER_REVOLUTION = UInt{1} << (std::numeric_limits<UInt>::digits - 2);
+    return binary_angle_sin(static_cast<UInt>(count + QUARTER_REVOLUTION));
+}
+
+// The number of `BamUnit` in `angle`, reduced modulo one revolution (that is, `2^N` for an
+// `N`-bit unsigned `UInt`).
+//
+// This first overload is for an integral angle which is an integer number of `BamUnit`.  We do all
+// arithmetic in `std::uint64_t`, whose wraparound is well defined, and preserves the count modulo
+// any smaller power of two.
+template <typename BamUnit, typename UInt, typename U, typename R>
+UInt wrapped_binary_angle_count(Quantity<U, R> angle, std::true_type) {
+    return static_cast<UInt>(static_cast<std::uint64_t>(angle.in(U{})) *
+                             get_value<std::uint64_t>(UnitRatioT<U, BamUnit>{}));
+}
+
+// This second overload handles every other angle.  It rounds to the nearest count.
+//
+// Precondition: the count is finite, and fits in a `std::int64_t`.
+template <typename BamUnit, typename UInt, typename U, typename R>
+UInt wrapped_binary_angle_count(Quantity<U, R> angle, std::false_type) {
+    using F = std::common_type_t<R, double>;
+    constexpr F REVOLUTION = static_cast<F>(std::numeric_limits<UInt>::max()) + F{1};
+    const F count = std::fmod(std::round(angle.template in<F>(BamUnit{})), REVOLUTION);
+    return static_cast<UInt>(static_cast<std::int64_t>(count));
+}
+
+template <typename BamUnit, typename UInt, typename U, typename R>
+Quantity<BamUnit, UInt> wrap_to_binary_angle(Quantity<U, R> angle) {
+    static_assert(HasSameDimension<U, BamUnit>{},
+                  "Can only wrap Angle-dimensioned Quantity instances to binary angles");
+    using IsExactInIntegers = stdx::conjunction<std::is_integral<R>,
+                                                IsInteger<UnitRatioT<U, BamUnit>>>;
+    return make_quantity<BamUnit>(
+        wrapped_binary_angle_count<BamUnit, UInt>(angle, IsExactInIntegers{}));
+}
 }  // namespace detail
 
 // The absolute value of a Quantity.
@@ -121,6 +241,36 @@ auto abs(Quantity<U, R> q) {
     return make_quantity<U>(std::abs(q.in(U{})));
 }
 
+// The phase angle of a complex Quantity.
+template <typename U, typename T>
+auto arg(Quantity<U, std::complex<T>> q) {
+    return radians(std::arg(q.in(U{})));
+}
+
+// The complex conjugate of a complex Quantity.
+template <typename U, typename T>
+auto conj(Quantity<U, std::complex<T>> q) {
+    return make_quantity<U>(std::conj(q.in(U{})));
+}
+
+// The squared magnitude of a complex Quantity, in the square of its unit.
+template <typename U, typename T>
+auto norm(Quantity<U, std::complex<T>> q) {
+    return make_quantity<UnitPowerT<U, 2>>(std::norm(q.in(U{})));
+}
+
+// The real part of a complex Quantity.
+template <typename U, typename T>
+auto real(Quantity<U, std::complex<T>> q) {
+    return make_quantity<U>(q.in(U{}).real());
+}
+
+// The imaginary part of a complex Quantity.
+template <typename U, typename T>
+auto imag(Quantity<U, std::complex<T>> q) {
+    return make_quantity<U>(q.in(U{}).imag());
+}
+
 // Wrapper for std::acos() which returns strongly typed angle quantity.
 template <typename T>
 auto arccos(T x) {
@@ -216,6 +366,10 @@ auto cos(Quantity<U, R> q) {
     return std::cos(detail::in_radians(q));
 }
 
+// Table-driven cos() of a binary angle, with an absolute error below 5e-6.
+inline float cos(Quantity<Bam16, std::uint16_t> q) { return detail::binary_angle_cos(q.in(bam16)); }
+inline float cos(Quantity<Bam32, std::uint32_t> q) { return detail::binary_angle_cos(q.in(bam32)); }
+
 // The floating point remainder of two values of the same dimension.
 template <typename U1, typename R1, typename U2, typename R2>
 auto fmod(Quantity<U1, R1> q1, Quantity<U2, R2> q2) {
@@ -629,6 +783,10 @@ auto sin(Quantity<U, R> q) {
     return std::sin(detail::in_radians(q));
 }
 
+// Table-driven sin() of a binary angle, with an absolute error below 5e-6.
+inline float sin(Quantity<Bam16, std::uint16_t> q) { return detail::binary_angle_sin(q.in(bam16)); }
+inline float sin(Quantity<Bam32, std::uint32_t> q) { return detail::binary_angle_sin(q.in(bam32)); }
+
 // Wrapper for std::sqrt() which handles Quantity types.
 template <typename U, typename R>
 auto sqrt(Quantity<U, R> q) {
@@ -641,6 +799,24 @@ auto tan(Quantity<U, R> q) {
     return std::tan(detail::in_radians(q));
 }
 
+// Convert any angle to a 16-bit binary angle, wrapping it into a single revolution.
+//
+// Integral inputs which are a whole number of `Bam16` (such as `revolutions(int)`, or the `int`
+// sum of two `Bam16` angles) use only integer arithmetic.  Other inputs round to the nearest count.
+template <typename U, typename R>
+Quantity<Bam16, std::uint16_t> wrap_to_bam16(Quantity<U, R> angle) {
+    return detail::wrap_to_binary_angle<Bam16, std::uint16_t>(angle);
+}
+
+// Convert any angle to a 32-bit binary angle, wrapping it into a single revolution.
+//
+// Integral inputs which are a whole number of `Bam32` use only integer arithmetic.  Other inputs
+// round to the nearest count.
+template <typename U, typename R>
+Quantity<Bam32, std::uint32_t> wrap_to_bam32(Quantity<U, R> angle) {
+    return detail::wrap_to_binary_angle<Bam32, std::uint32_t>(angle);
+}
+
 }  // namespace au
 
 namespace std {
@@ -14,6 +14,10 @@
 
 #include "au/math.hh"
 
+#include <complex>
+#include <cstdint>
+#include <limits>
+
 #include "au/prefix.hh"
 #include "au/testing.hh"
 #include "au/units/celsius.hh"
@@ -47,6 +51,20 @@ template <class T>
 constexpr const T &std_clamp(const T &v, const T &lo, const T &hi) {
     return std_clamp(v, lo, hi, std::less<void>{});
 }
+// The largest absolute error of `f(angle)`, compared to `std_f` of the same angle in radians, over
+// every `step`th count of the binary angle unit `BamUnit`.
+template <typename BamUnit, typename UInt, typename F, typename StdF>
+double max_binary_angle_error(F f, StdF std_f, std::uint64_t step) {
+    constexpr auto REVOLUTION = std::uint64_t{std::numeric_limits<UInt>::max()} + 1u;
+    double max_error = 0.0;
+    for (std::uint64_t count = 0u; count < REVOLUTION; count += step) {
+        const auto angle = make_quantity<BamUnit>(static_cast<UInt>(count));
+        const auto expected = std_f(angle.template in<double>(radians));
+        max_error = std::max(max_error, std::abs(static_cast<double>(f(angle)) - expected));
+    }
+    return max_error;
+}
+
 }  // namespace
 
 TEST(abs, AlwaysReturnsNonnegativeVersionOfInput) {
@@ -70,6 +88,33 @@ TEST(abs, SameAsStdAbsForNumericTypes) {
     EXPECT_EQ(abs(1), 1);
 }
 
+TEST(abs, GivesRealMagnitudeOfComplexQuantity) {
+    EXPECT_THAT(abs(meters(std::complex<double>{3.0, -4.0})), SameTypeAndValue(meters(5.0)));
+}
+
+TEST(arg, GivesPhaseOfComplexQuantityAsAngle) {
+    EXPECT_THAT(arg(meters(std::complex<double>{0.0, 2.0})),
+                SameTypeAndValue(radians(std::arg(std::complex<double>{0.0, 2.0}))));
+}
+
+TEST(conj, NegatesImaginaryPartAndKeepsUnit) {
+    EXPECT_THAT(conj(meters(std::complex<float>{1.0f, 2.0f})),
+                SameTypeAndValue(meters(std::complex<float>{1.0f, -2.0f})));
+}
+
+TEST(norm, GivesSquaredMagnitudeInSquaredUnit) {
+    EXPECT_THAT(norm(meters(std::complex<double>{3.0, -4.0})),
+                SameTypeAndValue(squared(meters)(25.0)));
+}
+
+TEST(real, GivesRealPartInSameUnit) {
+    EXPECT_THAT(real(meters(std::complex<double>{3.0, -4.0})), SameTypeAndValue(meters(3.0)));
+}
+
+TEST(imag, GivesImaginaryPartInSameUnit) {
+    EXPECT_THAT(imag(meters(std::complex<double>{3.0, -4.0})), SameTypeAndValue(meters(-4.0)));
+}
+
 TEST(clamp, QuantityConsistentWithStdClampWhenTypesAreIdentical) {
     auto expect_consistent_with_std_clamp = [](auto v, auto lo, auto hi) {
         const auto expected = ohms(std_clamp(v, lo, hi));
@@ -209,6 +254,22 @@ TEST(cos, GivesCorrectAnswersForInputsInDegrees) {
     EXPECT_NEAR(cos(degrees(90)), 0.0, TOL);
 }
 
+TEST(cos, UsesTableForBinaryAngles) {
+    StaticAssertTypeEq<decltype(cos(bam16(std::uint16_t{0}))), float>();
+    StaticAssertTypeEq<decltype(cos(bam32(std::uint32_t{0}))), float>();
+
+    EXPECT_EQ(cos(bam16(std::uint16_t{0})), 1.0f);
+    EXPECT_EQ(cos(bam16(std::uint16_t{32'768})), -1.0f);
+    EXPECT_EQ(cos(bam32(std::uint32_t{2'147'483'648})), -1.0f);
+}
+
+TEST(cos, TableForBinaryAnglesIsAccurate) {
+    const auto cos_of = [](auto angle) { return cos(angle); };
+    const auto std_cos = [](double x) { return std::cos(x); };
+    EXPECT_LT((max_binary_angle_error<Bam16, std::uint16_t>(cos_of, std_cos, 1u)), 5e-6);
+    EXPECT_LT((max_binary_angle_error<Bam32, std::uint32_t>(cos_of, std_cos, 65'537u)), 5e-6);
+}
+
 // Our `fmod` and `remainder` overloads mix conversions and computations.
 //
 // If their inputs have the same unit, then there is no conversion, only computation.  In that case,
@@ -444,6 +505,23 @@ TEST(sin, GivesCorrectAnswersForInputsInDegrees) {
     EXPECT_NEAR(sin(degrees(90)), 1.0, TOL);
 }
 
+TEST(sin, UsesTableForBinaryAngles) {
+    StaticAssertTypeEq<decltype(sin(bam16(std::uint16_t{0}))), float>();
+    StaticAssertTypeEq<decltype(sin(bam32(std::uint32_t{0}))), float>();
+
+    EXPECT_EQ(sin(bam16(std::uint16_t{0})), 0.0f);
+    EXPECT_EQ(sin(bam16(std::uint16_t{16'384})), 1.0f);
+    EXPECT_EQ(sin(bam16(std::uint16_t{49'152})), -1.0f);
+    EXPECT_EQ(sin(bam32(std::uint32_t{1'073'741'824})), 1.0f);
+}
+
+TEST(sin, TableForBinaryAnglesIsAccurate) {
+    const auto sin_of = [](auto angle) { return sin(angle); };
+    const auto std_sin = [](double x) { return std::sin(x); };
+    EXPECT_LT((max_binary_angle_error<Bam16, std::uint16_t>(sin_of, std_sin, 1u)), 5e-6);
+    EXPECT_LT((max_binary_angle_error<Bam32, std::uint32_t>(sin_of, std_sin, 65'537u)), 5e-6);
+}
+
 TEST(sqrt, OutputRepDependsOnInputRep) {
     EXPECT_THAT(sqrt(squared(meters)(4)), QuantityEquivalent(meters(2.)));
     EXPECT_THAT(sqrt(squared(meters)(4.)), QuantityEquivalent(meters(2.)));
@@ -505,6 +583,30 @@ TEST(tan, GivesSameAnswersAsRawNumbersButInStrongTypes) {
     EXPECT_THAT(tan(radians(4.56f)), SameTypeAndValue(std::tan(4.56f)));
 }
 
+TEST(wrap_to_bam16, WrapsIntegerAnglesUsingIntegerArithmetic) {
+    EXPECT_THAT(wrap_to_bam16(revolutions(3)), SameTypeAndValue(bam16(std::uint16_t{0})));
+    EXPECT_THAT(wrap_to_bam16(bam16(std::uint16_t{65'535}) + bam16(std::uint16_t{2})),
+                SameTypeAndValue(bam16(std::uint16_t{1})));
+    EXPECT_THAT(wrap_to_bam16(bam16(std::uint16_t{1}) - bam16(std::uint16_t{2})),
+                SameTypeAndValue(bam16(std::uint16_t{65'535})));
+}
+
+TEST(wrap_to_bam16, RoundsOtherAnglesToNearestCount) {
+    EXPECT_THAT(wrap_to_bam16(degrees(-90.0)), SameTypeAndValue(bam16(std::uint16_t{49'152})));
+    EXPECT_THAT(wrap_to_bam16(degrees(405)), SameTypeAndValue(bam16(std::uint16_t{8'192})));
+    EXPECT_THAT(wrap_to_bam16(revolutions(2.75f)), SameTypeAndValue(bam16(std::uint16_t{49'152})));
+    EXPECT_THAT(wrap_to_bam16(bam32(std::uint32_t{98'304})),
+                SameTypeAndValue(bam16(std::uint16_t{2})));
+}
+
+TEST(wrap_to_bam32, WrapsAnglesIntoOneRevolution) {
+    EXPECT_THAT(wrap_to_bam32(bam16(std::uint16_t{3})),
+                SameTypeAndValue(bam32(std::uint32_t{196'608})));
+    EXPECT_THAT(wrap_to_bam32(revolutions(-1)), SameTypeAndValue(bam32(std::uint32_t{0})));
+    EXPECT_THAT(wrap_to_bam32(radians(-3.14159265358979323846)),
+                SameTypeAndValue(bam32(std::uint32_t{2'147'483'648})));
+}
+
 TEST(arccos, TypeDependsOnInputType) {
     // See: https://en.cppreference.com/w/cpp/numeric/math/acos
     StaticAssertTypeEq<decltype(arccos(0)), Quantity<Radians, double>>();
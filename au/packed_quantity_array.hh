@@ -0,0 +1,260 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "au/quantity.hh"
+#include "au/stdx/span.hh"
+
+namespace au {
+
+namespace detail {
+
+// Zigzag-encode `d`, interpreted as a two's complement signed number, so that small values of
+// either sign become small unsigned numbers.  `U` must be unsigned, which makes all of the
+// wraparound arithmetic we do on differences well defined.
+template <typename U>
+constexpr std::uint64_t zigzag_encode(U d) {
+    static_assert(std::is_unsigned<U>::value, "Internal library error: U must be unsigned");
+    const U shifted = static_cast<U>(d << 1);
+    const bool is_negative = (d >> (std::numeric_limits<U>::digits - 1)) != 0u;
+    return is_negative ? static_cast<U>(~shifted) : shifted;
+}
+
+// The inverse of `zigzag_encode()`.
+template <typename U>
+constexpr U zigzag_decode(std::uint64_t z) {
+    static_assert(std::is_unsigned<U>::value, "Internal library error: U must be unsigned");
+    const U half = static_cast<U>(z >> 1);
+    return (z & 1u) ? static_cast<U>(~half) : half;
+}
+
+// The number of bits needed to represent `x`.
+inline unsigned int bit_width(std::uint64_t x) {
+    unsigned int width = 0u;
+    while (x != 0u) {
+        ++width;
+        x >>= 1;
+    }
+    return width;
+}
+
+// Read the `width`-bit value starting at bit `pos` of `words` (with `0 < width <= 64`).
+inline std::uint64_t read_packed_bits(const std::uint64_t *words, std::size_t pos, unsigned width) {
+    const std::size_t word = pos / 64u;
+    const unsigned int offset = static_cast<unsigned int>(pos % 64u);
+    std::uint64_t value = words[word] >> offset;
+    if (offset + width > 64u) {
+        value |= words[word + 1u] << (64u - offset);
+    }
+    return (width < 64u) ? (value & ((std::uint64_t{1} << width) - 1u)) : value;
+}
+}  // namespace detail
+
+// `PackedQuantityArray<U, R, BlockSize>`: an append-only, compressed sequence of `Quantity<U, R>`.
+//
+// This is designed for long integer time series (timestamps, encoder counts, and so on), where
+// consecutive values are close together.  Values are grouped into blocks of `BlockSize`.  Each
+// block stores its first value, and the first difference between consecutive values (its "stride").
+// Every other difference is stored as its deviation from the stride, packed into only as many bits
+// as the largest deviation in that block needs.  For steadily sampled 64-bit data, such as
+// timestamps with a little jitter, this often takes under a tenth of the raw storage.
+//
+// Blocks are independent, so any block can be decoded without touching the others.  The last block
+// is kept unpacked until it fills up, so appending is cheap.
+//
+// Appending takes a `Quantity<U, R>`, so values in any _implicitly_ convertible unit are converted
+// once, at the callsite, with the usual safety checks.
+template <typename UnitT, typename RepT, std::size_t BlockSize = 128u>
+class PackedQuantityArray {
+    static_assert(std::is_integral<RepT>::value, "PackedQuantityArray requires integral Rep");
+    static_assert(sizeof(RepT) <= sizeof(std::uint64_t), "Rep too large to pack");
+    static_assert(BlockSize > 0u, "BlockSize must be positive");
+
+ public:
+    using Rep = RepT;
+    using Unit = UnitT;
+    using QuantityType = Quantity<Unit, Rep>;
+    using UnsignedRep = std::make_unsigned_t<Rep>;
+
+    static constexpr std::size_t block_size() { return BlockSize; }
+
+    // The total number of values.
+    std::size_t size() const { return headers_.size() * BlockSize + tail_.size(); }
+    bool empty() const { return size() == 0u; }
+
+    // The number of blocks, including the (possibly partial) last block.
+    std::size_t num_blocks() const { return headers_.size() + (tail_.empty() ? 0u : 1u); }
+
+    // The number of values in block `b`: `BlockSize` for all but (possibly) the last.
+    std::size_t block_length(std::size_t b) const {
+        return (b < headers_.size()) ? BlockSize : tail_.size();
+    }
+
+    // Append a single value.
+    void push_back(QuantityType q) {
+        tail_.push_back(q.in(Unit{}));
+        if (tail_.size() == BlockSize) {
+            seal_tail();
+        }
+    }
+
+    // Append every value in `values`.
+    //
+    // Each value is converted exactly once, and this must be an implicit conversion.
+    template <typename U, typename R>
+    void append(stdx::span<const Quantity<U, R>> values) {
+        static_assert(std::is_convertible<Quantity<U, R>, QuantityType>::value,
+                      "append() requires values implicitly convertible to this array's type");
+        for (const auto &q : values) {
+            push_back(q);
+        }
+    }
+    template <typename U, typename R>
+    void append(stdx::span<Quantity<U, R>> values) {
+        append(stdx::span<const Quantity<U, R>>{values.data(), values.size()});
+    }
+
+    // Decode block `b` into the start of `out`, and return the number of values written.
+    //
+    // Precondition: `out.size() >= block_length(b)`.
+    std::size_t decode_block(std::size_t b, stdx::span<QuantityType> out) const {
+        if (b >= headers_.size()) {
+            for (std::size_t i = 0u; i < tail_.size(); ++i) {
+                out[i] = make_quantity<Unit>(tail_[i]);
+            }
+            return tail_.size();
+        }
+
+        // Unpack the differences first, then sum them, so that each loop stays simple.
+        const BlockHeader &h = headers_[b];
+        UnsignedRep deltas[BlockSize];
+        deltas[0] = 0u;
+        for (std::size_t i = 1u; i < BlockSize; ++i) {
+            deltas[i] = delta(h, i);
+        }
+        UnsignedRep x = static_cast<UnsignedRep>(h.first);
+        for (std::size_t i = 0u; i < BlockSize; ++i) {
+            x = static_cast<UnsignedRep>(x + deltas[i]);
+            out[i] = make_quantity<Unit>(static_cast<Rep>(x));
+        }
+        return BlockSize;
+    }
+
+    // Decode every value into the start of `out`, and return the number of values written.
+    //
+    // Precondition: `out.size() >= size()`.
+    std::size_t decode(stdx::span<QuantityType> out) const {
+        std::size_t n = 0u;
+        for (std::size_t b = 0u; b < num_blocks(); ++b) {
+            n += decode_block(b, out.subspan(n, out.size() - n));
+        }
+        return n;
+    }
+
+    // The value at index `i`.  This decodes part of one block, so prefer `decode_block()` (or
+    // `decode()`) for sequential access.
+    QuantityType operator[](std::size_t i) const {
+        const std::size_t b = i / BlockSize;
+        const std::size_t j = i % BlockSize;
+        if (b >= headers_.size()) {
+            return make_quantity<Unit>(tail_[j]);
+        }
+
+        const BlockHeader &h = headers_[b];
+        UnsignedRep x = static_cast<UnsignedRep>(h.first);
+        for (std::size_t k = 1u; k <= j; ++k) {
+            x = static_cast<UnsignedRep>(x + delta(h, k));
+        }
+        return make_quantity<Unit>(static_cast<Rep>(x));
+    }
+
+    void clear() {
+        headers_.clear();
+        words_.clear();
+        tail_.clear();
+    }
+
+    // The number of bytes currently used to hold the values (not counting unused capacity).
+    std::size_t storage_bytes() const {
+        return headers_.size() * sizeof(BlockHeader) + words_.size() * sizeof(std::uint64_t) +
+               tail_.size() * sizeof(Rep);
+    }
+
+ private:
+    struct BlockHeader {
+        Rep first;
+        UnsignedRep stride;
+        std::uint8_t width;
+        std::size_t word_offset;
+    };
+
+    // The difference between values `i - 1` and `i` (with `i > 0`) of the block with header `h`.
+    UnsignedRep delta(const BlockHeader &h, std::size_t i) const {
+        const std::uint64_t *words = words_.data() + h.word_offset;
+        const std::uint64_t z =
+            (h.width == 0u) ? 0u : detail::read_packed_bits(words, (i - 1u) * h.width, h.width);
+        return static_cast<UnsignedRep>(h.stride + detail::zigzag_decode<UnsignedRep>(z));
+    }
+
+    // The deviation of the difference between values `i - 1` and `i` of the tail from `stride`.
+    std::uint64_t zigzag_deviation(std::size_t i, UnsignedRep stride) const {
+        const auto d = static_cast<UnsignedRep>(static_cast<UnsignedRep>(tail_[i]) -
+                                                static_cast<UnsignedRep>(tail_[i - 1u]));
+        return detail::zigzag_encode(static_cast<UnsignedRep>(d - stride));
+    }
+
+    // Pack the (full) tail into a new block.
+    void seal_tail() {
+        const UnsignedRep stride =
+            (BlockSize > 1u) ? static_cast<UnsignedRep>(static_cast<UnsignedRep>(tail_[1u]) -
+                                                        static_cast<UnsignedRep>(tail_[0u]))
+                             : UnsignedRep{0u};
+        std::uint64_t all_bits = 0u;
+        for (std::size_t i = 1u; i < BlockSize; ++i) {
+            all_bits |= zigzag_deviation(i, stride);
+        }
+        const unsigned int width = detail::bit_width(all_bits);
+
+        headers_.push_back(
+            BlockHeader{tail_[0u], stride, static_cast<std::uint8_t>(width), words_.size()});
+
+        const std::size_t num_words = ((BlockSize - 1u) * width + 63u) / 64u;
+        const std::size_t start = words_.size();
+        words_.resize(start + num_words, 0u);
+        std::size_t pos = 0u;
+        for (std::size_t i = 1u; i < BlockSize && width > 0u; ++i, pos += width) {
+            const std::uint64_t z = zigzag_deviation(i, stride);
+            const std::size_t word = start + pos / 64u;
+            const unsigned int offset = static_cast<unsigned int>(pos % 64u);
+            words_[word] |= z << offset;
+            if (offset + width > 64u) {
+                words_[word + 1u] |= z >> (64u - offset);
+            }
+        }
+        tail_.clear();
+    }
+
+    std::vector<BlockHeader> headers_;
+    std::vector<std::uint64_t> words_;
+    std::vector<Rep> tail_;
+};
+
+}  // namespace au
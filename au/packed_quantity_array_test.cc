@@ -0,0 +1,171 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/packed_quantity_array.hh"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::Eq;
+
+namespace au {
+namespace {
+
+template <typename U, typename R, std::size_t N>
+std::vector<Quantity<U, R>> decode_all(const PackedQuantityArray<U, R, N> &packed) {
+    std::vector<Quantity<U, R>> out(packed.size());
+    EXPECT_THAT(packed.decode(stdx::make_span(out)), Eq(packed.size()));
+    return out;
+}
+
+}  // namespace
+
+TEST(Zigzag, MapsSmallValuesOfEitherSignToSmallNumbers) {
+    EXPECT_THAT(detail::zigzag_encode(0u), Eq(0u));
+    EXPECT_THAT(detail::zigzag_encode(static_cast<unsigned int>(-1)), Eq(1u));
+    EXPECT_THAT(detail::zigzag_encode(1u), Eq(2u));
+    EXPECT_THAT(detail::zigzag_encode(static_cast<unsigned int>(-2)), Eq(3u));
+    EXPECT_THAT(detail::zigzag_encode(uint8_t{254}), Eq(3u));
+}
+
+TEST(Zigzag, RoundTripsExtremeValues) {
+    for (const auto x : {uint64_t{0}, uint64_t{1}, ~uint64_t{0}, uint64_t{1} << 63}) {
+        EXPECT_THAT(detail::zigzag_decode<uint64_t>(detail::zigzag_encode(x)), Eq(x));
+    }
+    EXPECT_THAT(detail::zigzag_decode<uint16_t>(detail::zigzag_encode(uint16_t{32768})),
+                Eq(uint16_t{32768}));
+}
+
+TEST(PackedQuantityArray, StartsEmpty) {
+    const PackedQuantityArray<Seconds, int64_t> packed{};
+    EXPECT_TRUE(packed.empty());
+    EXPECT_THAT(packed.size(), Eq(0u));
+    EXPECT_THAT(packed.num_blocks(), Eq(0u));
+}
+
+TEST(PackedQuantityArray, RoundTripsAcrossFullAndPartialBlocks) {
+    PackedQuantityArray<Nano<Seconds>, int64_t, 8u> packed;
+    std::vector<QuantityI64<Nano<Seconds>>> expected;
+    for (int64_t i = 0; i < 21; ++i) {
+        const auto t = nano(seconds)(1'700'000'000'000'000'000 + i * 1'000'000 + (i % 3) * 17 - 5);
+        packed.push_back(t);
+        expected.push_back(t);
+    }
+
+    EXPECT_THAT(packed.size(), Eq(21u));
+    EXPECT_THAT(packed.num_blocks(), Eq(3u));
+    EXPECT_THAT(packed.block_length(1u), Eq(8u));
+    EXPECT_THAT(packed.block_length(2u), Eq(5u));
+    EXPECT_THAT(decode_all(packed), ElementsAreArray(expected));
+}
+
+TEST(PackedQuantityArray, DecodesAnySingleBlock) {
+    PackedQuantityArray<Meters, int32_t, 4u> packed;
+    for (int32_t i = 0; i < 10; ++i) {
+        packed.push_back(meters(i * i));
+    }
+
+    QuantityI32<Meters> buffer[4];
+    EXPECT_THAT(packed.decode_block(1u, stdx::make_span(buffer)), Eq(4u));
+    EXPECT_THAT(buffer, ElementsAre(meters(16), meters(25), meters(36), meters(49)));
+
+    EXPECT_THAT(packed.decode_block(2u, stdx::make_span(buffer)), Eq(2u));
+    EXPECT_THAT(buffer[0], SameTypeAndValue(meters(64)));
+    EXPECT_THAT(buffer[1], SameTypeAndValue(meters(81)));
+}
+
+TEST(PackedQuantityArray, SupportsRandomAccess) {
+    PackedQuantityArray<Meters, int32_t, 4u> packed;
+    for (int32_t i = 0; i < 10; ++i) {
+        packed.push_back(meters(100 - 7 * i));
+    }
+    for (int32_t i = 0; i < 10; ++i) {
+        EXPECT_THAT(packed[static_cast<std::size_t>(i)], SameTypeAndValue(meters(100 - 7 * i)));
+    }
+}
+
+TEST(PackedQuantityArray, HandlesConstantAndExtremeBlocks) {
+    constexpr auto lo = std::numeric_limits<int64_t>::lowest();
+    constexpr auto hi = std::numeric_limits<int64_t>::max();
+
+    PackedQuantityArray<Meters, int64_t, 4u> packed;
+    for (const auto x : {5, 5, 5, 5}) {
+        packed.push_back(meters(int64_t{x}));
+    }
+    for (const auto x : {lo, hi, lo, int64_t{0}}) {
+        packed.push_back(meters(int64_t{x}));
+    }
+
+    EXPECT_THAT(decode_all(packed),
+                ElementsAre(meters(int64_t{5}),
+                            meters(int64_t{5}),
+                            meters(int64_t{5}),
+                            meters(int64_t{5}),
+                            meters(lo),
+                            meters(hi),
+                            meters(lo),
+                            meters(int64_t{0})));
+    EXPECT_THAT(packed[6u], SameTypeAndValue(meters(lo)));
+}
+
+TEST(PackedQuantityArray, WorksWithUnsignedRep) {
+    PackedQuantityArray<Meters, uint16_t, 4u> packed;
+    for (const auto x : {65535, 0, 1, 65534, 3}) {
+        packed.push_back(meters(static_cast<uint16_t>(x)));
+    }
+    EXPECT_THAT(decode_all(packed),
+                ElementsAre(meters(uint16_t{65535}),
+                            meters(uint16_t{0}),
+                            meters(uint16_t{1}),
+                            meters(uint16_t{65534}),
+                            meters(uint16_t{3})));
+}
+
+TEST(PackedQuantityArray, ConvertsCompatibleUnitsOnAppend) {
+    PackedQuantityArray<Milli<Meters>, int64_t> packed;
+    packed.push_back(meters(int64_t{2}));
+
+    const std::vector<QuantityI64<Centi<Meters>>> more{centi(meters)(int64_t{3}),
+                                                       centi(meters)(int64_t{4})};
+    packed.append(stdx::make_span(more));
+
+    EXPECT_THAT(decode_all(packed),
+                ElementsAre(milli(meters)(int64_t{2'000}),
+                            milli(meters)(int64_t{30}),
+                            milli(meters)(int64_t{40})));
+}
+
+TEST(PackedQuantityArray, CompressesSlowlyVaryingSeriesSeveralfold) {
+    PackedQuantityArray<Nano<Seconds>, int64_t> packed;
+    const std::size_t n = 128u * 100u;
+    for (std::size_t i = 0u; i < n; ++i) {
+        const auto jitter = static_cast<int64_t>((i * 7u) % 13u);
+        packed.push_back(nano(seconds)(int64_t{1'000'000'000'000} +
+                                       static_cast<int64_t>(i) * 10'000'000 + jitter));
+    }
+
+    EXPECT_THAT(packed.size(), Eq(n));
+    EXPECT_LT(packed.storage_bytes() * 8u, n * sizeof(int64_t));
+}
+
+}  // namespace au
@@ -0,0 +1,335 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+//
+// Declarative encoding and decoding of packed, scaled-integer packets.
+//
+// Each field of a packet is an integer of some bit width, whose value is a `Quantity` or
+// `QuantityPoint` member of a struct, expressed in a "wire unit".  The wire unit carries both the
+// scale (the size of one LSB), and, for points, the offset (as the unit's origin).  For example, a
+// field of "0.01 m/s per LSB, offset -327.68 m/s" has this wire unit:
+//
+//     struct SpeedLsb : decltype(Centi<Meters>{} / Seconds{}) {
+//         static constexpr auto origin() { return (centi(meters) / second)(-32'768); }
+//     };
+//
+// Since the scale and offset are part of the wire unit's type, the library folds them together
+// with the member's own unit at compile time: each field costs one multiply and one add (or less).
+//
+// Fields are laid out back to back, starting at bit 0, in little-endian bit order: bit `i` of the
+// packet is bit `i % 8` of byte `i / 8`.  When encoding, out-of-range values saturate to the
+// nearest representable raw value, and floating point values round to the nearest raw value.
+//
+
+namespace detail {
+
+// Sign-extend the low `Bits` bits of `raw`.
+template <std::size_t Bits>
+constexpr int64_t sign_extend(uint64_t raw) {
+    constexpr uint64_t SIGN_BIT = uint64_t{1} << (Bits - 1u);
+    return static_cast<int64_t>((raw ^ SIGN_BIT) - SIGN_BIT);
+}
+
+// Read or write `Width` bits starting at bit `Offset`, in little-endian bit order.
+//
+// The loop bounds are compile time constants, so the compiler fully unrolls these loops.
+template <std::size_t Offset, std::size_t Width>
+uint64_t read_bits(const uint8_t *bytes) {
+    uint64_t value = 0u;
+    std::size_t shift = 0u;
+    for (std::size_t bit = Offset; bit < Offset + Width;) {
+        const std::size_t bit_in_byte = bit % 8u;
+        const std::size_t n = ((8u - bit_in_byte) < (Offset + Width - bit))
+                                  ? (8u - bit_in_byte)
+                                  : (Offset + Width - bit);
+        const uint64_t chunk = (static_cast<uint64_t>(bytes[bit / 8u]) >> bit_in_byte) &
+                               ((uint64_t{1} << n) - 1u);
+        value |= chunk << shift;
+        shift += n;
+        bit += n;
+    }
+    return value;
+}
+template <std::size_t Offset, std::size_t Width>
+void write_bits(uint8_t *bytes, uint64_t value) {
+    for (std::size_t bit = Offset; bit < Offset + Width;) {
+        const std::size_t bit_in_byte = bit % 8u;
+        const std::size_t n = ((8u - bit_in_byte) < (Offset + Width - bit))
+                                  ? (8u - bit_in_byte)
+                                  : (Offset + Width - bit);
+        const auto mask = static_cast<uint8_t>(((1u << n) - 1u) << bit_in_byte);
+        uint8_t &byte = bytes[bit / 8u];
+        byte = static_cast<uint8_t>((byte & ~mask) | ((value << bit_in_byte) & mask));
+        value >>= n;
+        bit += n;
+    }
+}
+
+// The raw value of a floating point member, in the wire unit, before rounding and saturation.
+template <typename WireUnit, typename U, typename R>
+constexpr R value_in_wire_unit(const Quantity<U, R> &q) {
+    return q.template in<R>(WireUnit{});
+}
+template <typename WireUnit, typename U, typename R>
+constexpr R value_in_wire_unit(const QuantityPoint<U, R> &p) {
+    return p.template in<R>(WireUnit{});
+}
+
+// For integral members, we check each step of the conversion for overflow _before_ we take it.
+// Every raw value fits in `int64_t`, so a value which would overflow the calculation rep is out of
+// range for the field, and saturates.  We compute in `uint64_t` for `uint64_t` quantities, so that
+// their values above `INT64_MAX` can still scale down into range, and in `int64_t` otherwise.
+template <typename R>
+using PacketIntCalcRep =
+    std::conditional_t<std::is_unsigned<R>::value && (sizeof(R) >= sizeof(uint64_t)),
+                       uint64_t,
+                       int64_t>;
+
+constexpr int64_t saturate_int_to_raw(int64_t x, int64_t lo, int64_t hi) {
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+constexpr int64_t saturate_int_to_raw(uint64_t x, int64_t, int64_t hi) {
+    // Every field's minimum raw value is at most zero, so only the maximum can apply.
+    return x > static_cast<uint64_t>(hi) ? hi : static_cast<int64_t>(x);
+}
+
+template <typename T>
+constexpr bool is_negative_int(T x) {
+    return std::is_signed<T>::value && !(x >= T{0});
+}
+
+template <typename WireUnit, typename U, typename R>
+constexpr int64_t saturated_raw_value(const Quantity<U, R> &q, int64_t lo, int64_t hi) {
+    using Calc = PacketIntCalcRep<R>;
+    using Scale = ApplyMagnitudeT<Calc, UnitRatioT<U, WireUnit>>;
+    const auto x = static_cast<Calc>(q.in(U{}));
+    return Scale::would_overflow(x) ? (is_negative_int(x) ? lo : hi)
+                                    : saturate_int_to_raw(Scale{}(x), lo, hi);
+}
+
+// Points compute `((a * x) + b) / d`, as `QuantityPoint::in()` does: `a` scales `x` to the common
+// point unit, `b` is the origin displacement in that unit, and `d` scales down to the wire unit.
+template <typename WireUnit, typename U, typename R>
+constexpr int64_t saturated_raw_value(const QuantityPoint<U, R> &p, int64_t lo, int64_t hi) {
+    static_assert(std::is_same<PacketIntCalcRep<R>, int64_t>::value,
+                  "Packet fields do not support QuantityPoint members with a 64-bit unsigned rep");
+    using Common = CommonPointUnitT<U, WireUnit>;
+    using ToCommon = ApplyMagnitudeT<int64_t, UnitRatioT<U, Common>>;
+    using ToWire = ApplyMagnitudeT<int64_t, UnitRatioT<Common, WireUnit>>;
+    constexpr int64_t b =
+        displacement_value_in<int64_t>(OriginDisplacement<WireUnit, U>::value(), Common{});
+    // The range of `a * x` for which adding `b` can't overflow.
+    constexpr int64_t AX_MAX = std::numeric_limits<int64_t>::max() - (b > 0 ? b : 0);
+    constexpr int64_t AX_MIN = std::numeric_limits<int64_t>::min() - (b < 0 ? b : 0);
+
+    const auto x = static_cast<int64_t>(p.in(U{}));
+    if (ToCommon::would_overflow(x)) {
+        return x < 0 ? lo : hi;
+    }
+    const int64_t ax = ToCommon{}(x);
+    return ax > AX_MAX ? hi : (ax < AX_MIN ? lo : saturate_int_to_raw(ToWire{}(ax + b), lo, hi));
+}
+
+template <typename WireUnit, typename U, typename R>
+void assign_from_wire_value(Quantity<U, R> &q, int64_t raw) {
+    q = make_quantity<WireUnit>(raw).template as<R>(U{});
+}
+template <typename WireUnit, typename U, typename R>
+void assign_from_wire_value(QuantityPoint<U, R> &p, int64_t raw) {
+    p = make_quantity_point<WireUnit>(raw).template as<R>(U{});
+}
+
+// Round the floating point value `x` to the nearest integer, saturating to `[lo, hi]`.
+template <typename T>
+constexpr int64_t round_float_to_raw(T x, int64_t lo, int64_t hi) {
+    return !(x > static_cast<T>(lo))
+               ? lo
+               : (x >= static_cast<T>(hi)
+                      ? hi
+                      : static_cast<int64_t>(x + static_cast<T>(x < T{0} ? -0.5 : 0.5)));
+}
+
+// The raw value of the member `m`, saturated to `[lo, hi]`.
+template <typename WireUnit, typename M>
+constexpr int64_t raw_value(const M &m, int64_t lo, int64_t hi, std::true_type /* is_float */) {
+    return round_float_to_raw(value_in_wire_unit<WireUnit>(m), lo, hi);
+}
+template <typename WireUnit, typename M>
+constexpr int64_t raw_value(const M &m, int64_t lo, int64_t hi, std::false_type /* is_float */) {
+    return saturated_raw_value<WireUnit>(m, lo, hi);
+}
+
+}  // namespace detail
+
+// A field of `Bits` bits, holding the member `Member Struct::*` in units of `WireUnit`.
+//
+// Make these with `bit_field<Bits>(&Struct::member, wire_unit)` (for unsigned raw values), or
+// `signed_bit_field<Bits>(...)` (for two's complement raw values).
+template <std::size_t Bits, bool IsSigned, typename Struct, typename Member, typename WireUnit>
+struct PacketField {
+    static_assert(Bits > 0u && Bits < 64u, "Packet fields must have between 1 and 63 bits");
+
+    static constexpr std::size_t BITS = Bits;
+
+    Member Struct::*member;
+
+    template <std::size_t Offset>
+    void encode(const Struct &s, uint8_t *bytes) const {
+        const int64_t raw = detail::raw_value<WireUnit>(
+            s.*member, RAW_MIN, RAW_MAX, std::is_floating_point<typename Member::Rep>{});
+        detail::write_bits<Offset, Bits>(bytes, static_cast<uint64_t>(raw));
+    }
+
+    template <std::size_t Offset>
+    void decode(const uint8_t *bytes, Struct &s) const {
+        const uint64_t bits = detail::read_bits<Offset, Bits>(bytes);
+        const int64_t raw = IsSigned ? detail::sign_extend<Bits>(bits) : static_cast<int64_t>(bits);
+        detail::assign_from_wire_value<WireUnit>(s.*member, raw);
+    }
+
+ private:
+    static constexpr int64_t RAW_MIN = IsSigned ? -(int64_t{1} << (Bits - 1u)) : int64_t{0};
+    static constexpr int64_t RAW_MAX = IsSigned ? (int64_t{1} << (Bits - 1u)) - 1
+                                                : static_cast<int64_t>((uint64_t{1} << Bits) - 1u);
+};
+
+// `Bits` bits which we skip: zero when encoding into a fresh packet, and ignored when decoding.
+template <std::size_t Bits>
+struct PacketPadding {
+    static constexpr std::size_t BITS = Bits;
+
+    template <std::size_t Offset, typename Struct>
+    void encode(const Struct &, uint8_t *) const {}
+
+    template <std::size_t Offset, typename Struct>
+    void decode(const uint8_t *, Struct &) const {}
+};
+
+namespace detail {
+template <typename U>
+using PacketWireUnit = AssociatedUnitT<AssociatedUnitForPointsT<U>>;
+}  // namespace detail
+
+template <std::size_t Bits, typename Struct, typename Member, typename WireUnit>
+constexpr auto bit_field(Member Struct::*member, WireUnit) {
+    return PacketField<Bits, false, Struct, Member, detail::PacketWireUnit<WireUnit>>{member};
+}
+
+template <std::size_t Bits, typename Struct, typename Member, typename WireUnit>
+constexpr auto signed_bit_field(Member Struct::*member, WireUnit) {
+    return PacketField<Bits, true, Struct, Member, detail::PacketWireUnit<WireUnit>>{member};
+}
+
+template <std::size_t Bits>
+constexpr auto padding_bits() {
+    return PacketPadding<Bits>{};
+}
+
+namespace detail {
+// The bit offset of the field at index `i`: the total width of the fields before it.
+template <typename... Fields>
+constexpr std::size_t packet_field_offset(std::size_t i) {
+    constexpr std::size_t bits[] = {Fields::BITS..., 0u};
+    std::size_t offset = 0u;
+    for (std::size_t j = 0u; j < i; ++j) {
+        offset += bits[j];
+    }
+    return offset;
+}
+}  // namespace detail
+
+// The layout of a whole packet, made from a sequence of fields.
+template <typename... Fields>
+class PacketLayout {
+ public:
+    static constexpr std::size_t NUM_BITS =
+        detail::packet_field_offset<Fields...>(sizeof...(Fields));
+    static constexpr std::size_t NUM_BYTES = (NUM_BITS + 7u) / 8u;
+    using Bytes = std::array<uint8_t, NUM_BYTES>;
+
+    constexpr explicit PacketLayout(Fields... fields) : fields_{fields...} {}
+
+    // Write every field of `s` into the `NUM_BYTES` bytes at `bytes`.  Padding bits are unchanged.
+    template <typename Struct>
+    void encode(const Struct &s, uint8_t *bytes) const {
+        encode_impl(s, bytes, std::index_sequence_for<Fields...>{});
+    }
+
+    // Encode `s` into a new packet, whose padding bits are zero.
+    template <typename Struct>
+    Bytes encode(const Struct &s) const {
+        Bytes bytes{};
+        encode(s, bytes.data());
+        return bytes;
+    }
+
+    // Read every field of `s` from the `NUM_BYTES` bytes at `bytes`.
+    template <typename Struct>
+    void decode(const uint8_t *bytes, Struct &s) const {
+        decode_impl(bytes, s, std::index_sequence_for<Fields...>{});
+    }
+    template <typename Struct>
+    void decode(const Bytes &bytes, Struct &s) const {
+        decode(bytes.data(), s);
+    }
+
+ private:
+    template <std::size_t I>
+    using Offset = std::integral_constant<std::size_t, detail::packet_field_offset<Fields...>(I)>;
+
+    template <typename Struct, std::size_t... Is>
+    void encode_impl(const Struct &s, uint8_t *bytes, std::index_sequence<Is...>) const {
+        const bool done[] = {
+            (std::get<Is>(fields_).template encode<Offset<Is>::value>(s, bytes), true)..., true};
+        (void)done;
+    }
+
+    template <typename Struct, std::size_t... Is>
+    void decode_impl(const uint8_t *bytes, Struct &s, std::index_sequence<Is...>) const {
+        const bool done[] = {
+            (std::get<Is>(fields_).template decode<Offset<Is>::value>(bytes, s), true)..., true};
+        (void)done;
+    }
+
+    std::tuple<Fields...> fields_;
+};
+
+template <typename... Fields>
+constexpr std::size_t PacketLayout<Fields...>::NUM_BITS;
+template <typename... Fields>
+constexpr std::size_t PacketLayout<Fields...>::NUM_BYTES;
+
+// Make a `PacketLayout` from its fields, in order.
+template <typename... Fields>
+constexpr PacketLayout<Fields...> packet_layout(Fields... fields) {
+    return PacketLayout<Fields...>{fields...};
+}
+
+}  // namespace au
@@ -0,0 +1,191 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/packet_codec.hh"
+
+#include <limits>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/celsius.hh"
+#include "au/units/degrees.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "au/units/volts.hh"
+#include "gtest/gtest.h"
+
+using ::testing::DoubleNear;
+using ::testing::ElementsAre;
+
+namespace au {
+namespace {
+
+using MetersPerSecond = UnitQuotientT<Meters, Seconds>;
+
+// 0.01 m/s per LSB, offset -327.68 m/s.
+struct SpeedLsb : decltype(Centi<Meters>{} / Seconds{}) {
+    static constexpr auto origin() { return (centi(meters) / second)(-32'768); }
+};
+
+// 0.5 degC per LSB, offset -40 degC.
+struct TemperatureLsb : decltype(Deci<Kelvins>{} * mag<5>()) {
+    static constexpr auto origin() { return centi(kelvins)(273'15 - 40'00); }
+};
+
+struct Telemetry {
+    QuantityPoint<MetersPerSecond, double> speed;
+    QuantityPoint<Celsius, float> temperature;
+    Quantity<Degrees, int32_t> heading;
+    Quantity<Milli<Volts>, int32_t> voltage;
+};
+
+constexpr auto TELEMETRY = packet_layout(bit_field<16>(&Telemetry::speed, SpeedLsb{}),
+                                         bit_field<8>(&Telemetry::temperature, TemperatureLsb{}),
+                                         signed_bit_field<12>(&Telemetry::heading, Degrees{}),
+                                         padding_bits<4>(),
+                                         bit_field<10>(&Telemetry::voltage, centi(volts)));
+
+struct Reading {
+    Quantity<Milli<Meters>, int32_t> distance;
+};
+
+struct WideReading {
+    Quantity<Volts, int64_t> voltage;
+    Quantity<Milli<Meters>, uint64_t> distance;
+    QuantityPoint<Celsius, int64_t> temperature;
+};
+
+constexpr auto WIDE_READING =
+    packet_layout(signed_bit_field<32>(&WideReading::voltage, nano(volts)),
+                  bit_field<16>(&WideReading::distance, tera(meters)),
+                  bit_field<8>(&WideReading::temperature, TemperatureLsb{}));
+
+}  // namespace
+
+TEST(PacketLayout, SizeIsTotalOfFieldWidthsRoundedUpToBytes) {
+    EXPECT_EQ(decltype(TELEMETRY)::NUM_BITS, 50u);
+    EXPECT_EQ(decltype(TELEMETRY)::NUM_BYTES, 7u);
+}
+
+TEST(PacketLayout, AppliesScaleAndOffset) {
+    Telemetry t{};
+    t.speed = make_quantity_point<MetersPerSecond>(0.0);
+    t.temperature = celsius_pt(-40.0f);
+    t.heading = degrees(0);
+    t.voltage = milli(volts)(0);
+
+    // Zero speed is raw 32768, and -40 degC is raw 0.
+    EXPECT_THAT(TELEMETRY.encode(t), ElementsAre(0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00));
+}
+
+TEST(PacketLayout, PacksFieldsInLittleEndianBitOrder) {
+    Telemetry t{};
+    t.speed = make_quantity_point<MetersPerSecond>(-327.67);  // Raw 0x0001.
+    t.temperature = celsius_pt(-39.5f);                       // Raw 0x01.
+    t.heading = degrees(-1);                                  // Raw 0xFFF.
+    t.voltage = milli(volts)(10'230);                         // Raw 0x3FF.
+
+    EXPECT_THAT(TELEMETRY.encode(t), ElementsAre(0x01, 0x00, 0x01, 0xFF, 0x0F, 0xFF, 0x03));
+}
+
+TEST(PacketLayout, RoundTripsValues) {
+    Telemetry t{};
+    t.speed = make_quantity_point<MetersPerSecond>(12.34);
+    t.temperature = celsius_pt(21.5f);
+    t.heading = degrees(-123);
+    t.voltage = milli(volts)(4'560);
+
+    Telemetry decoded{};
+    TELEMETRY.decode(TELEMETRY.encode(t), decoded);
+
+    EXPECT_THAT(decoded.speed.in(MetersPerSecond{}), DoubleNear(12.34, 1e-9));
+    EXPECT_THAT(decoded.temperature, SameTypeAndValue(celsius_pt(21.5f)));
+    EXPECT_THAT(decoded.heading, SameTypeAndValue(degrees(-123)));
+    EXPECT_THAT(decoded.voltage, SameTypeAndValue(milli(volts)(4'560)));
+}
+
+TEST(PacketLayout, RoundsFloatingPointToNearestRawValue) {
+    constexpr auto layout = packet_layout(bit_field<16>(&Telemetry::speed, SpeedLsb{}));
+    Telemetry t{};
+    t.speed = make_quantity_point<MetersPerSecond>(-0.006);
+
+    Telemetry decoded{};
+    layout.decode(layout.encode(t), decoded);
+    EXPECT_THAT(decoded.speed.in(MetersPerSecond{}), DoubleNear(-0.01, 1e-9));
+}
+
+TEST(PacketLayout, SaturatesOutOfRangeValues) {
+    Telemetry t{};
+    t.speed = make_quantity_point<MetersPerSecond>(1'000.0);
+    t.temperature = celsius_pt(-100.0f);
+    t.heading = degrees(5'000);
+    t.voltage = milli(volts)(-5);
+
+    Telemetry decoded{};
+    TELEMETRY.decode(TELEMETRY.encode(t), decoded);
+
+    EXPECT_THAT(decoded.speed.in(MetersPerSecond{}), DoubleNear(327.67, 1e-9));
+    EXPECT_THAT(decoded.temperature, SameTypeAndValue(celsius_pt(-40.0f)));
+    EXPECT_THAT(decoded.heading, SameTypeAndValue(degrees(2'047)));
+    EXPECT_THAT(decoded.voltage, SameTypeAndValue(milli(volts)(0)));
+}
+
+TEST(PacketLayout, SaturatesIntegersWhichWouldOverflowWhenScaled) {
+    // In nanovolts, these would overflow `int64_t`.
+    WideReading r{};
+    r.voltage = volts(int64_t{10'000'000'000});
+    r.temperature = celsius_pt(int64_t{-4'000'000'000'000'000'000});
+
+    WideReading decoded{};
+    WIDE_READING.decode(WIDE_READING.encode(r), decoded);
+    EXPECT_THAT(decoded.voltage, SameTypeAndValue(volts(int64_t{2})));
+    EXPECT_THAT(decoded.temperature, SameTypeAndValue(celsius_pt(int64_t{-40})));
+
+    r.voltage = volts(int64_t{-10'000'000'000});
+    r.temperature = celsius_pt(int64_t{4'000'000'000'000'000'000});
+    WIDE_READING.decode(WIDE_READING.encode(r), decoded);
+    EXPECT_THAT(decoded.voltage, SameTypeAndValue(volts(int64_t{-2})));
+    EXPECT_THAT(decoded.temperature, SameTypeAndValue(celsius_pt(int64_t{87})));
+}
+
+TEST(PacketLayout, ScalesUnsignedValuesAboveInt64MaxIntoRange) {
+    WideReading r{};
+    r.distance = milli(meters)(uint64_t{18'000'000'000'000'000'000u});
+
+    WideReading decoded{};
+    WIDE_READING.decode(WIDE_READING.encode(r), decoded);
+    EXPECT_THAT(decoded.distance,
+                SameTypeAndValue(milli(meters)(uint64_t{18'000'000'000'000'000'000u})));
+
+    r.distance = milli(meters)(std::numeric_limits<uint64_t>::max());
+    WIDE_READING.decode(WIDE_READING.encode(r), decoded);
+    EXPECT_THAT(decoded.distance,
+                SameTypeAndValue(milli(meters)(uint64_t{18'446'000'000'000'000'000u})));
+}
+
+TEST(PacketLayout, EncodingIntoBufferLeavesPaddingBitsUnchanged) {
+    constexpr auto layout = packet_layout(padding_bits<4>(),
+                                          bit_field<8>(&Reading::distance, centi(meters)),
+                                          padding_bits<4>());
+    uint8_t bytes[] = {0xFF, 0xFF};
+    layout.encode(Reading{milli(meters)(120)}, bytes);
+    EXPECT_EQ(bytes[0], 0xCF);
+    EXPECT_EQ(bytes[1], 0xF0);
+
+    Reading decoded{};
+    layout.decode(bytes, decoded);
+    EXPECT_THAT(decoded.distance, SameTypeAndValue(milli(meters)(120)));
+}
+
+}  // namespace au
@@ -18,6 +18,8 @@
 
 #include "au/apply_magnitude.hh"
 #include "au/conversion_policy.hh"
+#include "au/conversion_sanitizer.hh"
+#include "au/conversion_trace.hh"
 #include "au/operators.hh"
 #include "au/rep.hh"
 #include "au/stdx/functional.hh"
@@ -148,6 +150,12 @@ class Quantity {
         using Common = std::common_type_t<Rep, NewRep>;
         using Factor = UnitRatioT<AssociatedUnitT<Unit>, AssociatedUnitT<NewUnit>>;
 
+#if AU_ENABLE_CONVERSION_TRACING
+        detail::trace_conversion<Unit, Rep, AssociatedUnitT<NewUnit>, NewRep>();
+#endif
+#if AU_ENABLE_CONVERSION_SANITIZER
+        detail::check_conversion<Unit, Rep, AssociatedUnitT<NewUnit>, NewRep>(value_);
+#endif
         return make_quantity<AssociatedUnitT<NewUnit>>(
             static_cast<NewRep>(detail::apply_magnitude(static_cast<Common>(value_), Factor{})));
     }
@@ -330,6 +338,8 @@ class Quantity {
     }
 
     // Short-hand addition and subtraction assignment.
+    //
+    // These are members (unlike the unary operators below), so that they also work on rvalues.
     constexpr Quantity &operator+=(Quantity other) {
         value_ += other.value_;
         return *this;
@@ -368,8 +378,12 @@ class Quantity {
     }
 
     // Unary plus and minus.
-    constexpr Quantity operator+() const { return {+value_}; }
-    constexpr Quantity operator-() const { return {-value_}; }
+    //
+    // These are hidden friends, rather than members, because debug info describes every member
+    // function of every `Quantity` type, whether the program uses it or not.  For friends, we only
+    // pay for what we use.
+    friend constexpr Quantity operator+(Quantity q) { return {+q.value_}; }
+    friend constexpr Quantity operator-(Quantity q) { return {-q.value_}; }
 
     // Automatic conversion to Rep for Unitless type.
     template <typename U = UnitT, typename = std::enable_if_t<IsUnitlessUnit<U>::value>>
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "au/quantity.hh"
+#include "au/stdx/span.hh"
 #include "au/stdx/type_traits.hh"
 #include "au/utility/type_traits.hh"
 
@@ -55,6 +59,17 @@ struct OriginDisplacementFitsIn;
 
 template <typename FromRep, typename ToRep>
 struct IntermediateRep;
+
+template <typename FromUnit, typename ToUnit, typename T, bool IsTIntegral>
+struct AffinePointConversionImpl;
+template <typename FromUnit, typename ToUnit, typename T>
+using AffinePointConversion =
+    AffinePointConversionImpl<FromUnit, ToUnit, T, std::is_integral<T>::value>;
+
+#if AU_ENABLE_CONVERSION_SANITIZER
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+constexpr void check_point_conversion(const FromRep &x);
+#endif
 }  // namespace detail
 
 // QuantityPoint implementation and API elaboration.
@@ -135,27 +150,38 @@ class QuantityPoint {
     template <typename NewRep,
               typename NewUnit,
               typename = std::enable_if_t<IsUnit<AssociatedUnitForPointsT<NewUnit>>::value>>
-    constexpr NewRep in(NewUnit u) const {
+    constexpr NewRep in(NewUnit) const {
         using CalcRep = typename detail::IntermediateRep<Rep, NewRep>::type;
-        return (rep_cast<CalcRep>(x_) -
-                rep_cast<CalcRep>(
-                    OriginDisplacement<Unit, AssociatedUnitForPointsT<NewUnit>>::value()))
-            .template in<NewRep>(associated_unit_for_points(u));
+        using Conversion =
+            detail::AffinePointConversion<Unit, AssociatedUnitForPointsT<NewUnit>, CalcRep>;
+#if AU_ENABLE_CONVERSION_TRACING
+        detail::trace_conversion<Unit, Rep, AssociatedUnitForPointsT<NewUnit>, NewRep>();
+#endif
+#if AU_ENABLE_CONVERSION_SANITIZER
+        detail::check_point_conversion<Unit, Rep, AssociatedUnitForPointsT<NewUnit>, NewRep>(
+            x_.in(unit));
+#endif
+        return static_cast<NewRep>(Conversion::apply(static_cast<CalcRep>(x_.in(unit))));
     }
 
     template <typename NewUnit,
               typename = std::enable_if_t<IsUnit<AssociatedUnitForPointsT<NewUnit>>::value>>
     constexpr Rep in(NewUnit u) const {
+        using Target = AssociatedUnitForPointsT<NewUnit>;
+        static_assert(detail::OriginDisplacementFitsIn<Rep, Target, Unit>::value,
+                      "Cannot represent origin displacement in desired Rep");
+
+        // Since Rep was requested _implicitly_, apply the same safety checks as we would for the
+        // unit conversion of `x_ + origin_displacement(...)`, which is where a rep of `Rep` could
+        // overflow or truncate.  (We don't compute it that way, though: see `in<NewRep>(u)`.)
+        using Sum = decltype(x_ + rep_cast<Rep>(OriginDisplacement<Target, Unit>::value()));
+        using SumUnit = typename Sum::Unit;
         static_assert(
-            detail::OriginDisplacementFitsIn<Rep, AssociatedUnitForPointsT<NewUnit>, Unit>::value,
-            "Cannot represent origin displacement in desired Rep");
+            implicit_rep_permitted_from_source_to_target<Rep>(SumUnit{}, Target{}),
+            "Dangerous conversion for integer Rep!  See: "
+            "https://aurora-opensource.github.io/au/main/troubleshooting/#dangerous-conversion");
 
-        // `rep_cast` is needed because if these are integral types, their difference might become a
-        // different type due to integer promotion.
-        return rep_cast<Rep>(
-                   x_ + rep_cast<Rep>(
-                            OriginDisplacement<AssociatedUnitForPointsT<NewUnit>, Unit>::value()))
-            .in(associated_unit_for_points(u));
+        return in<Rep>(u);
     }
 
     // "Old-style" overloads with <U, R> template parameters, and no function parameters.
@@ -315,6 +341,54 @@ constexpr auto rep_cast(QuantityPoint<Unit, Rep> q) {
     return q.template as<NewRep>(Unit{});
 }
 
+// Convert each point in `from` to the type of the corresponding element of `to`, ignoring safety
+// checks for overflow and truncation.
+//
+// This is equivalent to `to[i] = from[i].coerce_as<NewR>(NewU{})` for each element.
+//
+// Precondition: `to.size() >= from.size()`.
+template <typename U, typename R, typename NewU, typename NewR>
+void coerce_points(stdx::span<const QuantityPoint<U, R>> from,
+                   stdx::span<QuantityPoint<NewU, NewR>> to) {
+    using CalcRep = typename detail::IntermediateRep<R, NewR>::type;
+    using Conversion = detail::AffinePointConversion<U, NewU, CalcRep>;
+    for (std::size_t i = 0u; i < from.size(); ++i) {
+#if AU_ENABLE_CONVERSION_TRACING
+        detail::trace_conversion<U, R, NewU, NewR>();
+#endif
+#if AU_ENABLE_CONVERSION_SANITIZER
+        detail::check_point_conversion<U, R, NewU, NewR>(from[i].data_in(U{}));
+#endif
+        to[i] = make_quantity_point<NewU>(
+            static_cast<NewR>(Conversion::apply(static_cast<CalcRep>(from[i].data_in(U{})))));
+    }
+}
+template <typename U, typename R, typename NewU, typename NewR>
+void coerce_points(stdx::span<QuantityPoint<U, R>> from,
+                   stdx::span<QuantityPoint<NewU, NewR>> to) {
+    coerce_points(stdx::span<const QuantityPoint<U, R>>{from}, to);
+}
+
+// Convert each point in `from` to the type of the corresponding element of `to`.
+//
+// This is equivalent to `to[i] = from[i]` for each element, and therefore applies the same safety
+// checks as implicit construction.  However, all of the unit and origin bookkeeping is done once,
+// at compile time: the loop body is a single multiply-add for each element.
+//
+// Precondition: `to.size() >= from.size()`.
+template <typename U, typename R, typename NewU, typename NewR>
+void convert_points(stdx::span<const QuantityPoint<U, R>> from,
+                    stdx::span<QuantityPoint<NewU, NewR>> to) {
+    static_assert(std::is_convertible<QuantityPoint<U, R>, QuantityPoint<NewU, NewR>>::value,
+                  "Dangerous conversion: use coerce_points() to ignore safety checks");
+    coerce_points(from, to);
+}
+template <typename U, typename R, typename NewU, typename NewR>
+void convert_points(stdx::span<QuantityPoint<U, R>> from,
+                    stdx::span<QuantityPoint<NewU, NewR>> to) {
+    convert_points(stdx::span<const QuantityPoint<U, R>>{from}, to);
+}
+
 //
 // QuantityPoint aliases to set a particular Rep.
 //
@@ -452,5 +526,247 @@ template <typename FromRep, typename ToRep>
 struct IntermediateRep
     : IntermediateRepImpl<std::common_type_t<FromRep, ToRep>, std::is_signed<ToRep>::value> {};
 
+// The value of an origin displacement (which may be `Zero`), expressed in the given unit and rep.
+template <typename T, typename TargetUnit>
+constexpr T displacement_value_in(Zero, TargetUnit) {
+    return T{0};
+}
+template <typename T, typename TargetUnit, typename U, typename R>
+constexpr T displacement_value_in(Quantity<U, R> q, TargetUnit target) {
+    return q.template in<T>(target);
+}
+
+// `AffinePointConversion<FromUnit, ToUnit, T>::apply(x)` takes the value `x` of a point in
+// `FromUnit`, and returns its value in `ToUnit`, computing in the rep `T`.
+//
+// This is an affine map, `x -> (scale * x) + offset`.  Both the scale and the offset are computed
+// at compile time, so that each conversion is a single multiply-add at runtime, rather than
+// converting the origin displacement and then the magnitude separately.
+//
+// For floating point types, we apply the scale via `apply_magnitude()` (so that, e.g., dividing by
+// an integer stays a division), and add the offset in the target unit.  Writing this as a single
+// expression lets the compiler contract it into an FMA instruction where available.  (We can't call
+// `std::fma` directly, because it's not `constexpr`.)
+template <typename FromUnit, typename ToUnit, typename T>
+struct AffinePointConversionImpl<FromUnit, ToUnit, T, false> {
+    static constexpr T apply(T x) {
+        constexpr T offset =
+            displacement_value_in<T>(OriginDisplacement<ToUnit, FromUnit>::value(), ToUnit{});
+        return apply_magnitude(x, UnitRatioT<FromUnit, ToUnit>{}) + offset;
+    }
+};
+
+// For integral types, we want the exact answer, truncated towards zero just as for any other
+// integer unit conversion.  We compute in the common point unit of the source and target, where
+// both the scale factor and the origin displacement are integers: `x -> ((a * x) + b) / d`.  We use
+// the widest integral type of the appropriate signedness, so that intermediate values don't
+// overflow any sooner than they need to.
+template <typename FromUnit, typename ToUnit, typename T>
+struct AffinePointConversionImpl<FromUnit, ToUnit, T, true> {
+    using Wide = std::conditional_t<std::is_signed<T>::value, std::intmax_t, std::uintmax_t>;
+    using Common = CommonPointUnitT<FromUnit, ToUnit>;
+
+    static constexpr Wide a() { return get_value<Wide>(unit_ratio(FromUnit{}, Common{})); }
+    static constexpr Wide b() {
+        return displacement_value_in<Wide>(OriginDisplacement<ToUnit, FromUnit>::value(),
+                                           Common{});
+    }
+    static constexpr Wide d() { return get_value<Wide>(unit_ratio(ToUnit{}, Common{})); }
+
+    static constexpr T apply(T x) {
+        constexpr Wide A = a();
+        constexpr Wide B = b();
+        constexpr Wide D = d();
+        return static_cast<T>((static_cast<Wide>(x) * A + B) / D);
+    }
+};
+
+#if AU_ENABLE_CONVERSION_SANITIZER
+// Check each step of `QuantityPoint::in<ToRep>()`, as `check_conversion()` does for `Quantity`.
+//
+// For integral calculation reps, that's `(a * x) + b` (for overflow), and then the division by `d`
+// (for truncation).  For floating point, it's the scale factor (for overflow).  Either way, we also
+// check the casts to the calculation rep, and to the target rep.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_affine_point_conversion(const FromRep &x, std::true_type /* integral calc rep */) {
+    using T = typename IntermediateRep<FromRep, ToRep>::type;
+    using Conversion = AffinePointConversion<FromUnit, ToUnit, T>;
+    using Wide = typename Conversion::Wide;
+    using Scale = ApplyMagnitudeT<Wide, UnitRatioT<FromUnit, typename Conversion::Common>>;
+    const auto report = &report_conversion_loss<FromUnit, FromRep, ToUnit, ToRep>;
+
+    // We get the sign of `b` from a signed type, because `Conversion::b()` may have wrapped around.
+    constexpr std::intmax_t B = displacement_value_in<std::intmax_t>(
+        OriginDisplacement<ToUnit, FromUnit>::value(), typename Conversion::Common{});
+    constexpr Wide AX_MAX = std::numeric_limits<Wide>::max() - static_cast<Wide>(B > 0 ? B : 0);
+    constexpr Wide AX_MIN = std::numeric_limits<Wide>::lowest() + static_cast<Wide>(B < 0 ? -B : 0);
+
+    if (static_cast_overflows<T>(x)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const auto wide = static_cast<Wide>(static_cast<T>(x));
+    if (Scale::would_overflow(wide)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const Wide ax = Scale{}(wide);
+    if (ax > AX_MAX || ax < AX_MIN) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const Wide result = (ax + Conversion::b()) / Conversion::d();
+    if (static_cast_overflows<T>(result) || static_cast_overflows<ToRep>(result)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    if ((ax + Conversion::b()) % Conversion::d() != 0) {
+        return report(ConversionLossKind::TRUNCATES);
+    }
+}
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_affine_point_conversion(const FromRep &x, std::false_type /* integral calc rep */) {
+    using T = typename IntermediateRep<FromRep, ToRep>::type;
+    using Scale = ApplyMagnitudeT<T, UnitRatioT<FromUnit, ToUnit>>;
+    const auto report = &report_conversion_loss<FromUnit, FromRep, ToUnit, ToRep>;
+
+    if (static_cast_overflows<T>(x)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const auto calc = static_cast<T>(x);
+    if (!is_non_finite(calc) && Scale::would_overflow(calc)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    const T result = AffinePointConversion<FromUnit, ToUnit, T>::apply(calc);
+    if (static_cast_overflows<ToRep>(result)) {
+        return report(ConversionLossKind::OVERFLOWS);
+    }
+    if (static_cast_truncates<ToRep>(result)) {
+        return report(ConversionLossKind::TRUNCATES);
+    }
+}
+
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_point_conversion_at_runtime(const FromRep &x, std::true_type /* reps are arithmetic */) {
+    check_affine_point_conversion<FromUnit, FromRep, ToUnit, ToRep>(
+        x, std::is_integral<typename IntermediateRep<FromRep, ToRep>::type>{});
+}
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+void check_point_conversion_at_runtime(const FromRep &, std::false_type /* reps are arithmetic */) {
+}
+
+// Check the conversion of the point value `x` from `FromUnit` and `FromRep` to `ToUnit` and `ToRep`
+// for overflow and truncation.
+//
+// Like `check_conversion()`, this does nothing during constant evaluation.
+template <typename FromUnit, typename FromRep, typename ToUnit, typename ToRep>
+constexpr void check_point_conversion(const FromRep &x) {
+    if (!stdx::is_constant_evaluated()) {
+        check_point_conversion_at_runtime<FromUnit, FromRep, ToUnit, ToRep>(
+            x, stdx::conjunction<IsCheckableRep<FromRep>, IsCheckableRep<ToRep>>{});
+    }
+}
+#endif
+
+// Helpers for the bulk arithmetic operations below.
+//
+// Each computes the _value_ of the result of a single `QuantityPoint` operation, in the unit and
+// rep which that operation would produce.  All unit and origin bookkeeping is folded into compile
+// time constants, so that the offset between origins (if any) gets added only once per element.
+template <typename P1, typename P2>
+struct PointDifferenceKernel;
+template <typename U1, typename R1, typename U2, typename R2>
+struct PointDifferenceKernel<QuantityPoint<U1, R1>, QuantityPoint<U2, R2>> {
+    using Unit1 = U1;
+    using Unit2 = U2;
+
+    // Computing this type applies all of the same safety checks as the single-element operation.
+    using Result =
+        decltype(std::declval<QuantityPoint<U1, R1>>() - std::declval<QuantityPoint<U2, R2>>());
+    using Unit = typename Result::Unit;
+    using Rep = typename Result::Rep;
+
+    static constexpr Rep apply(R1 x1, R2 x2) {
+        constexpr Rep offset =
+            displacement_value_in<Rep>(OriginDisplacement<U2, U1>::value(), Unit{});
+        return static_cast<Rep>(
+            (apply_magnitude(static_cast<Rep>(x1), UnitRatioT<U1, Unit>{}) -
+             apply_magnitude(static_cast<Rep>(x2), UnitRatioT<U2, Unit>{})) +
+            offset);
+    }
+};
+
+template <typename P, typename Q, typename Op>
+struct PointDeltaKernel;
+template <typename UP, typename RP, typename UQ, typename RQ, typename Op>
+struct PointDeltaKernel<QuantityPoint<UP, RP>, Quantity<UQ, RQ>, Op> {
+    using PointUnit = UP;
+    using DeltaUnit = UQ;
+
+    // Computing this type applies all of the same safety checks as the single-element operation.
+    using Result =
+        decltype(Op{}(std::declval<QuantityPoint<UP, RP>>(), std::declval<Quantity<UQ, RQ>>()));
+    using Unit = typename Result::Unit;
+    using Rep = typename Result::Rep;
+
+    static constexpr Rep apply(RP x, RQ dx) {
+        // The result unit always borrows the origin of `UP`, but we don't rely on that here.
+        constexpr Rep offset =
+            displacement_value_in<Rep>(OriginDisplacement<Unit, UP>::value(), Unit{});
+        const Rep scaled_x = apply_magnitude(static_cast<Rep>(x), UnitRatioT<UP, Unit>{});
+        const Rep scaled_dx = apply_magnitude(static_cast<Rep>(dx), UnitRatioT<UQ, Unit>{});
+        return static_cast<Rep>(Op{}(scaled_x, scaled_dx) + offset);
+    }
+};
+
 }  // namespace detail
+
+// Bulk arithmetic on contiguous ranges of points.
+//
+// Each of these functions is equivalent to applying the corresponding single-element operation to
+// each element (and then implicitly converting the result to the output element type).  They
+// produce results in the same common units, and apply the same safety checks.  However, all of the
+// unit and origin bookkeeping is hoisted out of the loop, and computed at compile time.
+//
+// Precondition: `out.size() >= p1.size()`, and every input span is at least as large as `p1`.  The
+// output span is permitted to be the same as any input span, to support updating in place.
+
+// `out[i] = p1[i] - p2[i]`.
+template <typename P1, typename P2, typename D>
+void subtract_points(stdx::span<P1> p1, stdx::span<P2> p2, stdx::span<D> out) {
+    using Kernel = detail::PointDifferenceKernel<std::remove_const_t<P1>, std::remove_const_t<P2>>;
+    using Result = typename Kernel::Result;
+    static_assert(std::is_convertible<Result, D>::value,
+                  "Output element type must be implicitly constructible from the difference");
+    for (std::size_t i = 0u; i < p1.size(); ++i) {
+        out[i] = make_quantity<typename Kernel::Unit>(
+            Kernel::apply(p1[i].data_in(typename Kernel::Unit1{}),
+                          p2[i].data_in(typename Kernel::Unit2{})));
+    }
+}
+
+// `out[i] = points[i] + deltas[i]`.
+template <typename P, typename Q, typename D>
+void add_to_points(stdx::span<P> points, stdx::span<Q> deltas, stdx::span<D> out) {
+    using Kernel = detail::
+        PointDeltaKernel<std::remove_const_t<P>, std::remove_const_t<Q>, detail::Plus>;
+    static_assert(std::is_convertible<typename Kernel::Result, D>::value,
+                  "Output element type must be implicitly constructible from the sum");
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        out[i] = make_quantity_point<typename Kernel::Unit>(
+            Kernel::apply(points[i].data_in(typename Kernel::PointUnit{}),
+                          deltas[i].data_in(typename Kernel::DeltaUnit{})));
+    }
+}
+
+// `out[i] = points[i] - deltas[i]`.
+template <typename P, typename Q, typename D>
+void subtract_from_points(stdx::span<P> points, stdx::span<Q> deltas, stdx::span<D> out) {
+    using Kernel = detail::
+        PointDeltaKernel<std::remove_const_t<P>, std::remove_const_t<Q>, detail::Minus>;
+    static_assert(std::is_convertible<typename Kernel::Result, D>::value,
+                  "Output element type must be implicitly constructible from the difference");
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        out[i] = make_quantity_point<typename Kernel::Unit>(
+            Kernel::apply(points[i].data_in(typename Kernel::PointUnit{}),
+                          deltas[i].data_in(typename Kernel::DeltaUnit{})));
+    }
+}
+
 }  // namespace au
@@ -14,11 +14,14 @@
 
 #include "au/quantity_point.hh"
 
+#include <vector>
+
 #include "au/prefix.hh"
 #include "au/testing.hh"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+using ::testing::ElementsAre;
 using ::testing::Not;
 using ::testing::StaticAssertTypeEq;
 
@@ -195,11 +198,124 @@ TEST(QuantityPoint, CanCastToUnitWithDifferentOrigin) {
     EXPECT_THAT(celsius_pt(10).coerce_as(Kelvins{}), SameTypeAndValue(kelvins_pt(283)));
 }
 
+TEST(QuantityPoint, CanCastToUnitWithDifferentMagnitudeAndOrigin) {
+    EXPECT_THAT(milli(kelvins_pt)(283'150.0).as(celsius_pt),
+                IsNear(celsius_pt(10.0), nano(kelvins)(1)));
+    EXPECT_THAT(celsius_pt(10.0).as(milli(kelvins_pt)),
+                IsNear(milli(kelvins_pt)(283'150.0), nano(kelvins)(1)));
+}
+
+TEST(QuantityPoint, IntegerCastWithDifferentOriginTruncatesTowardsZero) {
+    EXPECT_THAT(milli(kelvins_pt)(283'159).coerce_as(celsius_pt), SameTypeAndValue(celsius_pt(10)));
+    EXPECT_THAT(milli(kelvins_pt)(272'150).coerce_as(celsius_pt), SameTypeAndValue(celsius_pt(-1)));
+    EXPECT_THAT(milli(kelvins_pt)(272'151).coerce_as(celsius_pt), SameTypeAndValue(celsius_pt(0)));
+}
+
+TEST(QuantityPoint, IntegerCastWithDifferentOriginIsExactEvenIfIntermediateValueExceedsRep) {
+    // 2'147'600 K is 2'147'600'000 mK, which is too big for `int32_t`, although the answer is not.
+    EXPECT_THAT(kelvins_pt(int32_t{2'147'600}).coerce_as(milli(celsius_pt)),
+                SameTypeAndValue(milli(celsius_pt)(int32_t{2'147'326'850})));
+}
+
 TEST(QuantityPoint, HandlesConversionWithSignedSourceAndUnsignedDestination) {
     EXPECT_THAT(celsius_pt(int16_t{-5}).coerce_as<uint16_t>(kelvins_pt),
                 SameTypeAndValue(kelvins_pt(uint16_t{268})));
 }
 
+TEST(ConvertPoints, ConvertsEachPointToOutputType) {
+    const std::vector<QuantityPointI32<Celsius>> temps{
+        celsius_pt(0), celsius_pt(10), celsius_pt(-5)};
+    std::vector<QuantityPointI32<Milli<Kelvins>>> result(temps.size());
+
+    convert_points(stdx::make_span(temps), stdx::make_span(result));
+
+    EXPECT_THAT(result,
+                ElementsAre(SameTypeAndValue(milli(kelvins_pt)(273'150)),
+                            SameTypeAndValue(milli(kelvins_pt)(283'150)),
+                            SameTypeAndValue(milli(kelvins_pt)(268'150))));
+}
+
+TEST(ConvertPoints, AcceptsMutableInput) {
+    QuantityPointD<Kelvins> temps[] = {kelvins_pt(273.15), kelvins_pt(373.15)};
+    QuantityPointD<Celsius> result[2];
+
+    convert_points(stdx::make_span(temps), stdx::make_span(result));
+
+    EXPECT_THAT(result[0], IsNear(celsius_pt(0.0), nano(kelvins)(1)));
+    EXPECT_THAT(result[1], IsNear(celsius_pt(100.0), nano(kelvins)(1)));
+}
+
+TEST(CoercePoints, AgreesWithCoerceAsForEachPoint) {
+    const std::vector<QuantityPointI32<Milli<Kelvins>>> temps{
+        milli(kelvins_pt)(283'159), milli(kelvins_pt)(272'150), milli(kelvins_pt)(272'151)};
+    std::vector<QuantityPointI32<Celsius>> result(temps.size());
+
+    coerce_points(stdx::make_span(temps), stdx::make_span(result));
+
+    for (std::size_t i = 0u; i < temps.size(); ++i) {
+        EXPECT_THAT(result[i], SameTypeAndValue(temps[i].coerce_as(celsius_pt)));
+    }
+}
+
+TEST(SubtractPoints, AgreesWithSubtractionForEachElement) {
+    const std::vector<QuantityPointI32<Celsius>> p1{celsius_pt(0), celsius_pt(10), celsius_pt(-5)};
+    const std::vector<QuantityPointI32<Milli<Kelvins>>> p2{
+        milli(kelvins_pt)(0), milli(kelvins_pt)(273'150), milli(kelvins_pt)(300'001)};
+    std::vector<QuantityI32<Milli<Kelvins>>> result(p1.size());
+
+    subtract_points(stdx::make_span(p1), stdx::make_span(p2), stdx::make_span(result));
+
+    for (std::size_t i = 0u; i < p1.size(); ++i) {
+        EXPECT_THAT(result[i], SameTypeAndValue(p1[i] - p2[i]));
+    }
+}
+
+TEST(SubtractPoints, ConvertsToOutputElementType) {
+    const QuantityPointD<Celsius> p1[] = {celsius_pt(20.0), celsius_pt(-40.0)};
+    const QuantityPointD<Kelvins> p2[] = {kelvins_pt(273.15), kelvins_pt(0.0)};
+    QuantityD<Milli<Kelvins>> result[2];
+
+    subtract_points(stdx::make_span(p1), stdx::make_span(p2), stdx::make_span(result));
+
+    EXPECT_THAT(result[0], IsNear(milli(kelvins)(20'000.0), nano(kelvins)(1)));
+    EXPECT_THAT(result[1], IsNear(milli(kelvins)(233'150.0), nano(kelvins)(1)));
+}
+
+TEST(AddToPoints, AgreesWithAdditionForEachElement) {
+    const std::vector<QuantityPointD<Celsius>> points{celsius_pt(20.0), celsius_pt(-3.5)};
+    const std::vector<QuantityD<Milli<Kelvins>>> deltas{milli(kelvins)(1.5), milli(kelvins)(-2.0)};
+    std::vector<decltype(points[0] + deltas[0])> result(points.size());
+
+    add_to_points(stdx::make_span(points), stdx::make_span(deltas), stdx::make_span(result));
+
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        EXPECT_THAT(result[i], IsNear(points[i] + deltas[i], nano(kelvins)(1)));
+    }
+}
+
+TEST(AddToPoints, SupportsUpdatingInPlace) {
+    std::vector<QuantityPointI32<Centi<Meters>>> points{centi(meters_pt)(5), centi(meters_pt)(-7)};
+    const std::vector<QuantityI32<Meters>> deltas{meters(1), meters(2)};
+
+    add_to_points(stdx::make_span(points), stdx::make_span(deltas), stdx::make_span(points));
+
+    EXPECT_THAT(points,
+                ElementsAre(SameTypeAndValue(centi(meters_pt)(105)),
+                            SameTypeAndValue(centi(meters_pt)(193))));
+}
+
+TEST(SubtractFromPoints, AgreesWithSubtractionForEachElement) {
+    const std::vector<QuantityPointI32<Celsius>> points{celsius_pt(20), celsius_pt(-3)};
+    const std::vector<QuantityI32<Milli<Kelvins>>> deltas{milli(kelvins)(1), milli(kelvins)(-2)};
+    std::vector<decltype(points[0] - deltas[0])> result(points.size());
+
+    subtract_from_points(stdx::make_span(points), stdx::make_span(deltas), stdx::make_span(result));
+
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        EXPECT_THAT(result[i], SameTypeAndValue(points[i] - deltas[i]));
+    }
+}
+
 TEST(QuantityPoint, CoerceAsWillForceLossyConversion) {
     // Truncation.
     EXPECT_THAT(inches_pt(30).coerce_as(feet_pt), SameTypeAndValue(feet_pt(2)));
@@ -434,4 +550,5 @@ TEST(OriginDisplacementFitsIn, FailsNegativeDisplacementForUnsignedRep) {
     EXPECT_TRUE((OriginDisplacementFitsIn<int16_t, Celsius, Kelvins>::value));
 }
 }  // namespace detail
+
 }  // namespace au
@@ -0,0 +1,58 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "au/quantity.hh"
+#include "au/stdx/span.hh"
+
+namespace au {
+
+namespace detail {
+
+// `Q`, with the same constness as `T`.
+template <typename T, typename Q>
+using CopyConstT = std::conditional_t<std::is_const<T>::value, const Q, Q>;
+
+}  // namespace detail
+
+// Convert each element of the contiguous range `from`, and store it in the range `to`.
+//
+// Every element conversion must be implicit.  This works in either direction, between quantities
+// and the types which correspond to them, as well as between two `Quantity` types.
+//
+// This always copies.  We deliberately offer no zero-copy "view" of a range of some other type as a
+// range of `Quantity`: no `Quantity` objects exist in that memory, so accessing it through
+// a `Quantity` pointer would be undefined behavior, even though the layouts match.
+//
+// Precondition: `to` has at least as many elements as `from`.
+template <typename From, typename To>
+void convert_quantities(From &&from, To &&to) {
+    const auto in = stdx::make_span(from);
+    const auto out = stdx::make_span(to);
+    using InT = std::remove_const_t<typename decltype(in)::element_type>;
+    using OutT = typename decltype(out)::element_type;
+    static_assert(!std::is_const<OutT>::value, "Cannot convert into a range of const values");
+    static_assert(std::is_convertible<InT, OutT>::value,
+                  "convert_quantities() requires an implicit conversion");
+
+    for (std::size_t i = 0u; i < in.size(); ++i) {
+        out[i] = in[i];
+    }
+}
+
+}  // namespace au
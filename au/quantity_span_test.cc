@@ -0,0 +1,100 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/quantity_span.hh"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "au/chrono_interop.hh"
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+
+namespace au {
+namespace {
+
+// A third-party length type which stores millimeters as an `int32_t`.
+struct LegacyMillimeters {
+    int32_t mm;
+};
+
+// A type which corresponds to a quantity, but whose layout does not (it has extra data).
+struct TaggedMeters {
+    double value;
+    int tag;
+};
+
+}  // namespace
+
+template <>
+struct CorrespondingQuantity<LegacyMillimeters> {
+    using Unit = Milli<Meters>;
+    using Rep = int32_t;
+
+    static constexpr Rep extract_value(LegacyMillimeters x) { return x.mm; }
+    static constexpr LegacyMillimeters construct_from_value(Rep x) { return {x}; }
+};
+
+template <>
+struct CorrespondingQuantity<TaggedMeters> {
+    using Unit = Meters;
+    using Rep = double;
+
+    static constexpr Rep extract_value(TaggedMeters x) { return x.value; }
+};
+
+TEST(ConvertQuantities, CopiesTypesWithCorrespondingQuantity) {
+    const std::vector<std::chrono::milliseconds> durations{std::chrono::milliseconds{5},
+                                                           std::chrono::milliseconds{8}};
+
+    std::vector<QuantityI64<Milli<Seconds>>> as_au(durations.size());
+    convert_quantities(durations, as_au);
+    EXPECT_THAT(as_au, ElementsAre(milli(seconds)(int64_t{5}), milli(seconds)(int64_t{8})));
+}
+
+TEST(ConvertQuantities, ConvertsWhenUnitsDiffer) {
+    const std::vector<std::chrono::milliseconds> durations{std::chrono::milliseconds{1'500},
+                                                           std::chrono::milliseconds{250}};
+
+    std::vector<QuantityI64<Micro<Seconds>>> as_au(durations.size());
+    convert_quantities(durations, as_au);
+    EXPECT_THAT(as_au,
+                ElementsAre(micro(seconds)(int64_t{1'500'000}), micro(seconds)(int64_t{250'000})));
+}
+
+TEST(ConvertQuantities, ConvertsBackToCorrespondingTypes) {
+    const QuantityI32<Meters> lengths[] = {meters(1), meters(2)};
+
+    std::array<LegacyMillimeters, 2> legacy{};
+    convert_quantities(lengths, stdx::make_span(legacy));
+    EXPECT_EQ(legacy[0].mm, 1'000);
+    EXPECT_EQ(legacy[1].mm, 2'000);
+}
+
+TEST(ConvertQuantities, WorksWhenLayoutDiffers) {
+    const std::vector<TaggedMeters> tagged{{1.5, 7}, {2.5, 9}};
+
+    std::vector<QuantityD<Centi<Meters>>> as_au(tagged.size());
+    convert_quantities(tagged, as_au);
+    EXPECT_THAT(as_au, ElementsAre(centi(meters)(150.0), centi(meters)(250.0)));
+}
+
+}  // namespace au
@@ -522,6 +522,11 @@ TEST(Quantity, ShortHandAdditionHasReferenceCharacter) {
     EXPECT_EQ(d, (feet(4)));
 }
 
+TEST(Quantity, ShortHandAdditionAndSubtractionWorkOnRvalues) {
+    EXPECT_THAT(feet(1) += feet(2), SameTypeAndValue(feet(3)));
+    EXPECT_THAT(feet(5) -= feet(2), SameTypeAndValue(feet(3)));
+}
+
 TEST(Quantity, ShortHandSubtractionAssignmentWorks) {
     auto d = feet(4.75);
     d -= feet(2.75);
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include "au/stdx/experimental/is_detected.hh"
@@ -44,6 +45,37 @@ struct IsProductValidRep;
 template <typename T, typename U>
 struct IsQuotientValidRep;
 
+//
+// The real number type underlying the rep `T`: `T` itself, unless `T` is a complex number type.
+//
+// We recognize a complex number type, such as `std::complex<T>`, by its shape: a `value_type`,
+// which its `real()` and `imag()` member functions both return.  (We can't name `std::complex`
+// here without including `<complex>`, and a specialization in some other header would not be
+// visible everywhere the rep is used.)  Any other complex number type can become a fully supported
+// rep by specializing this trait.  We convert units of a complex value by multiplying it by a
+// `RealPartT<T>`, and a complex rep follows the conversion policy of its real part.
+//
+namespace detail {
+template <typename T>
+using ComplexValueType = std::enable_if_t<
+    stdx::conjunction<
+        std::is_same<std::decay_t<decltype(std::declval<const T &>().real())>,
+                     typename T::value_type>,
+        std::is_same<std::decay_t<decltype(std::declval<const T &>().imag())>,
+                     typename T::value_type>>::value,
+    typename T::value_type>;
+}  // namespace detail
+
+template <typename T>
+struct RealPart
+    : stdx::type_identity<stdx::experimental::detected_or_t<T, detail::ComplexValueType, T>> {
+    static_assert(std::is_same<typename RealPart::type, T>::value ||
+                      std::is_floating_point<typename RealPart::type>::value,
+                  "Only complex numbers of a floating point type are supported as a rep");
+};
+template <typename T>
+using RealPartT = typename RealPart<T>::type;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Implementation details below.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +109,9 @@ struct HasCorrespondingQuantity
     : stdx::conjunction<stdx::experimental::is_detected<CorrespondingUnit, T>,
                         stdx::experimental::is_detected<CorrespondingRep, T>> {};
 
+template <typename T>
+struct IsComplexRep : stdx::negation<std::is_same<RealPartT<T>, T>> {};
+
 template <typename T>
 using LooksLikeAuOrOtherQuantity = stdx::disjunction<IsAuType<T>, HasCorrespondingQuantity<T>>;
 
@@ -108,6 +143,74 @@ struct ResultIfNoneAreQuantity
                                   Op,
                                   Ts...> {};
 
+template <typename T>
+struct RepLabel {
+    static constexpr const char *value() {
+        return std::is_floating_point<T>::value
+                   ? "[floating point]"
+                   : (IsComplexRep<T>::value ? "[complex]" : "[UNLABELED REP]");
+    }
+};
+template <>
+struct RepLabel<float> {
+    static constexpr const char *value() { return "float"; }
+};
+template <>
+struct RepLabel<double> {
+    static constexpr const char *value() { return "double"; }
+};
+template <>
+struct RepLabel<long double> {
+    static constexpr const char *value() { return "long double"; }
+};
+
+template <std::size_t Bytes, bool IsSigned>
+struct IntRepLabel {
+    static constexpr const char *value() { return "[UNLABELED REP]"; }
+};
+template <>
+struct IntRepLabel<1u, true> {
+    static constexpr const char *value() { return "int8_t"; }
+};
+template <>
+struct IntRepLabel<2u, true> {
+    static constexpr const char *value() { return "int16_t"; }
+};
+template <>
+struct IntRepLabel<4u, true> {
+    static constexpr const char *value() { return "int32_t"; }
+};
+template <>
+struct IntRepLabel<8u, true> {
+    static constexpr const char *value() { return "int64_t"; }
+};
+template <>
+struct IntRepLabel<1u, false> {
+    static constexpr const char *value() { return "uint8_t"; }
+};
+template <>
+struct IntRepLabel<2u, false> {
+    static constexpr const char *value() { return "uint16_t"; }
+};
+template <>
+struct IntRepLabel<4u, false> {
+    static constexpr const char *value() { return "uint32_t"; }
+};
+template <>
+struct IntRepLabel<8u, false> {
+    static constexpr const char *value() { return "uint64_t"; }
+};
+
+// A human-readable name for the rep `T`, for diagnostics (such as conversion tracing).
+//
+// Integral types get their fixed-width name, because that's what we spell out in our codebases.
+template <typename T>
+constexpr const char *rep_label() {
+    return std::conditional_t<std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                              IntRepLabel<sizeof(T), std::is_signed<T>::value>,
+                              RepLabel<T>>::value();
+}
+
 // The `std::is_empty` is a good way to catch all of the various unit and other monovalue types in
 // our library, which have little else in common.  It's also just intrinsically true that it
 // wouldn't make much sense to use an empty type as a rep.
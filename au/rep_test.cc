@@ -15,6 +15,7 @@
 #include "au/rep.hh"
 
 #include <complex>
+#include <vector>
 
 #include "au/chrono_interop.hh"
 #include "au/constant.hh"
@@ -48,6 +49,15 @@ struct LeftMultiplyDoubleByThree {
     friend double operator*(const LeftMultiplyDoubleByThree &, double x) { return 3.0 * x; }
 };
 
+// A custom complex number type.
+struct MyComplex {
+    using value_type = double;
+    double real() const { return re; }
+    double imag() const { return im; }
+    double re;
+    double im;
+};
+
 // A custom type that divides a `float` into `10.0f`.
 struct DivideTenByFloat {
     friend float operator/(const DivideTenByFloat &, float x) { return 10.0f / x; }
@@ -76,6 +86,17 @@ TEST(IsValidRep, TrueForStdComplex) {
     EXPECT_TRUE(IsValidRep<std::complex<uint16_t>>::value);
 }
 
+TEST(RealPartT, IsRealTypeUnderlyingComplexRep) {
+    StaticAssertTypeEq<RealPartT<std::complex<double>>, double>();
+    StaticAssertTypeEq<RealPartT<std::complex<float>>, float>();
+    StaticAssertTypeEq<RealPartT<int>, int>();
+}
+
+TEST(RealPartT, RecognizesAnyComplexNumberTypeByItsShape) {
+    StaticAssertTypeEq<RealPartT<MyComplex>, double>();
+    StaticAssertTypeEq<RealPartT<std::vector<double>>, std::vector<double>>();
+}
+
 TEST(IsValidRep, FalseForMagnitude) {
     EXPECT_FALSE(IsValidRep<decltype(mag<84>())>::value);
     EXPECT_FALSE(IsValidRep<decltype(sqrt(PI))>::value);
@@ -0,0 +1,132 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "au/atomic_quantity.hh"
+#include "au/quantity.hh"
+
+namespace au {
+
+namespace detail {
+// We assume 64-byte cache lines, which holds for every platform we currently target.  (We can't use
+// `std::hardware_destructive_interference_size`, because it's C++17.)
+constexpr std::size_t CACHE_LINE_SIZE = 64u;
+
+// Assign each thread a small integer, round-robin, the first time it asks.
+inline std::size_t this_thread_shard_index() {
+    static std::atomic<std::size_t> next_index{0u};
+    thread_local const std::size_t index = next_index.fetch_add(1u, std::memory_order_relaxed);
+    return index;
+}
+}  // namespace detail
+
+// `ShardedCounter<Quantity<U, R>, NumShards>`: a quantity-valued counter for heavy concurrent use.
+//
+// A single `AtomicQuantity` can become a bottleneck when many threads update it, because every
+// update must take exclusive ownership of the same cache line.  This counter instead keeps
+// `NumShards` separate atomic values, each on its own cache line, and each thread always updates
+// the same shard.  Reading the counter merges the shards into a single `Quantity`.
+//
+// Updates accept any quantity which is implicitly convertible to `Quantity<U, R>`, just like
+// `AtomicQuantity`.  Reads are not a consistent snapshot with respect to concurrent updates: each
+// shard is read atomically, but the shards are read one after another.
+template <typename Q, std::size_t NumShards = 16u>
+class ShardedCounter;
+
+template <typename UnitT, typename RepT, std::size_t NumShards>
+class ShardedCounter<Quantity<UnitT, RepT>, NumShards> {
+    static_assert(NumShards > 0u, "ShardedCounter needs at least one shard");
+
+ public:
+    using Rep = RepT;
+    using Unit = UnitT;
+    using QuantityType = Quantity<Unit, Rep>;
+
+    ShardedCounter() noexcept = default;
+    ShardedCounter(const ShardedCounter &) = delete;
+    ShardedCounter &operator=(const ShardedCounter &) = delete;
+
+    // Add `delta` to this thread's shard.
+    void add(QuantityType delta, std::memory_order order = std::memory_order_relaxed) noexcept {
+        this_thread_shard().fetch_add(delta, order);
+    }
+
+    // Subtract `delta` from this thread's shard.
+    void subtract(QuantityType delta,
+                  std::memory_order order = std::memory_order_relaxed) noexcept {
+        this_thread_shard().fetch_sub(delta, order);
+    }
+
+    // The merged total of all shards.
+    QuantityType read(std::memory_order order = std::memory_order_relaxed) const noexcept {
+        QuantityType total = ZERO;
+        for (const auto &shard : shards_) {
+            total += shard.value.load(order);
+        }
+        return total;
+    }
+
+    // Reset every shard to zero, and return the merged total of what they held.
+    //
+    // No update is ever lost: each one is counted either in the returned total, or in a later read.
+    QuantityType reset(std::memory_order order = std::memory_order_relaxed) noexcept {
+        QuantityType total = ZERO;
+        for (auto &shard : shards_) {
+            total += shard.value.exchange(ZERO, order);
+        }
+        return total;
+    }
+
+    static constexpr std::size_t num_shards() { return NumShards; }
+
+ private:
+    // Pad each shard out to a full cache line.  We pad (rather than using `alignas`) because
+    // over-aligned heap allocation isn't supported before C++17; values spaced a full cache line
+    // apart can never share one, regardless of the alignment of the whole array.
+    struct Shard {
+        AtomicQuantity<Unit, Rep> value;
+        char padding[detail::CACHE_LINE_SIZE - sizeof(AtomicQuantity<Unit, Rep>)];
+    };
+    static_assert(sizeof(AtomicQuantity<Unit, Rep>) < detail::CACHE_LINE_SIZE,
+                  "Rep too large to shard");
+
+    AtomicQuantity<Unit, Rep> &this_thread_shard() noexcept {
+        return shards_[detail::this_thread_shard_index() % NumShards].value;
+    }
+
+    std::array<Shard, NumShards> shards_{};
+};
+
+// The average rate of change for a counter which increased by `delta` over `interval`.
+//
+// For example, if `delta` is in bytes, and `interval` is a steady clock duration (which we can get
+// via `as_quantity(end - start)`), the result will be in bytes per nanosecond (or whatever the
+// clock's period is); call `.as(bytes / second)` to get it in a more convenient unit.
+//
+// Integer division is too lossy to compute rates, so we use `double` unless the inputs are already
+// floating point.
+template <typename U, typename R, typename TU, typename TR>
+constexpr auto average_rate(Quantity<U, R> delta, Quantity<TU, TR> interval) {
+    using T = std::common_type_t<R, TR>;
+    using CalcRep = std::conditional_t<std::is_floating_point<T>::value, T, double>;
+    return rep_cast<CalcRep>(delta) / rep_cast<CalcRep>(interval);
+}
+
+}  // namespace au
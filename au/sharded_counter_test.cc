@@ -0,0 +1,81 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/sharded_counter.hh"
+
+#include <thread>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/bits.hh"
+#include "au/units/bytes.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(ShardedCounter, StartsAtZero) {
+    const ShardedCounter<QuantityU64<Bytes>> counter{};
+    EXPECT_THAT(counter.read(), SameTypeAndValue(bytes(uint64_t{0})));
+}
+
+TEST(ShardedCounter, ReadMergesUpdates) {
+    ShardedCounter<QuantityI64<Bytes>> counter{};
+    counter.add(bytes(int64_t{5}));
+    counter.add(kilo(bytes)(int64_t{2}));
+    counter.subtract(bytes(int64_t{1}));
+    EXPECT_THAT(counter.read(), SameTypeAndValue(bytes(int64_t{2'004})));
+}
+
+TEST(ShardedCounter, ShardsOccupySeparateCacheLines) {
+    EXPECT_GE(sizeof(ShardedCounter<QuantityU64<Bytes>, 4u>), 4u * detail::CACHE_LINE_SIZE);
+}
+
+TEST(ShardedCounter, ResetReturnsTotalAndZeroesCounter) {
+    ShardedCounter<QuantityD<Seconds>> counter{};
+    counter.add(milli(seconds)(500.0));
+    EXPECT_THAT(counter.reset(), SameTypeAndValue(seconds(0.5)));
+    EXPECT_THAT(counter.read(), SameTypeAndValue(seconds(0.0)));
+}
+
+TEST(ShardedCounter, ConcurrentUpdatesFromManyThreadsAreAllCounted) {
+    ShardedCounter<QuantityU64<Bits>, 4u> counter{};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1'000; ++j) {
+                counter.add(bytes(uint64_t{1}));
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    EXPECT_THAT(counter.read(), SameTypeAndValue(bits(uint64_t{64'000})));
+}
+
+TEST(AverageRate, UsesDoubleForIntegralInputs) {
+    const auto rate = average_rate(bytes(uint64_t{3'000}), milli(seconds)(int64_t{1'500}));
+    EXPECT_THAT(rate.as(bytes / second), SameTypeAndValue((bytes / second)(2'000.0)));
+}
+
+TEST(AverageRate, PreservesFloatingPointRep) {
+    EXPECT_THAT(average_rate(bytes(3.0f), seconds(2.0f)),
+                SameTypeAndValue((bytes / second)(1.5f)));
+}
+
+}  // namespace au
@@ -0,0 +1,340 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "au/quantity.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+// `StateVector<Quantity<U1, R>, Quantity<U2, R>, ...>`: a fixed-size vector whose elements can each
+// have a different unit.
+//
+// The values are stored contiguously, as raw `R`, so `data()` can be handed to numerical kernels
+// without copying.  Access through `get<I>()` and `set<I>()` is unit-safe, like a `Quantity`.
+template <typename... Qs>
+class StateVector;
+
+// `StateMatrix<RowVector, ColVector>`: a fixed-size matrix whose entry `(i, j)` has the product of
+// the units of element `i` of `RowVector`, and element `j` of `ColVector` (both `StateVector`s).
+//
+// For example, the covariance of a state vector `V` is a `StateMatrix<V, V>`, and a matrix which
+// maps `V` to another state vector `W` is a `StateMatrix<W, StateVectorInverseT<V>>`.  Values are
+// stored contiguously, as raw reps, in row-major order.
+template <typename RowVector, typename ColVector>
+class StateMatrix;
+
+// The `StateVector` whose units are the inverses of those of `V`.
+template <typename V>
+struct StateVectorInverse;
+template <typename V>
+using StateVectorInverseT = typename StateVectorInverse<V>::type;
+
+namespace detail {
+template <typename T>
+struct IsQuantityElement : std::false_type {};
+template <typename U, typename R>
+struct IsQuantityElement<Quantity<U, R>> : std::true_type {};
+
+template <typename... Ts>
+using FirstOfT = std::tuple_element_t<0, std::tuple<Ts...>>;
+
+// The `StateVector` whose units are the units of `V`, each multiplied by `U`.
+template <typename V, typename U>
+struct ScaleStateVectorUnits;
+template <typename... Qs, typename U>
+struct ScaleStateVectorUnits<StateVector<Qs...>, U>
+    : stdx::type_identity<
+          StateVector<Quantity<UnitProductT<typename Qs::Unit, U>, typename Qs::Rep>...>> {};
+template <typename V, typename U>
+using ScaleStateVectorUnitsT = typename ScaleStateVectorUnits<V, U>::type;
+
+// Whether the terms `Q1s[k] * Q2s[k]` all have quantity-equivalent units (and there are as many of
+// each).  Only then can we sum them as raw numbers.
+template <typename V1, typename V2, typename Enable = void>
+struct HaveConsistentTermUnits : std::false_type {};
+template <typename... Q1s, typename... Q2s>
+struct HaveConsistentTermUnits<StateVector<Q1s...>,
+                               StateVector<Q2s...>,
+                               std::enable_if_t<sizeof...(Q1s) == sizeof...(Q2s)>>
+    : stdx::conjunction<AreUnitsQuantityEquivalent<
+          UnitProductT<typename Q1s::Unit, typename Q2s::Unit>,
+          UnitProductT<typename FirstOfT<Q1s...>::Unit, typename FirstOfT<Q2s...>::Unit>>...> {};
+
+// The unit of every term in the inner product of `StateVector`s `V1` and `V2`.
+template <typename V1, typename V2>
+struct InnerProductUnit;
+template <typename... Q1s, typename... Q2s>
+struct InnerProductUnit<StateVector<Q1s...>, StateVector<Q2s...>>
+    : stdx::type_identity<
+          UnitProductT<typename FirstOfT<Q1s...>::Unit, typename FirstOfT<Q2s...>::Unit>> {
+    static_assert(sizeof...(Q1s) == sizeof...(Q2s), "Inner dimensions of product must match");
+    static_assert(HaveConsistentTermUnits<StateVector<Q1s...>, StateVector<Q2s...>>::value ||
+                      sizeof...(Q1s) != sizeof...(Q2s),
+                  "Every term of a StateMatrix product must have the same unit");
+};
+template <typename V1, typename V2>
+using InnerProductUnitT = typename InnerProductUnit<V1, V2>::type;
+
+// Whether `StateMatrix<V1, V2>` is square, and every entry on its diagonal is unitless.
+template <typename V1, typename V2, typename Enable = void>
+struct HasUnitlessDiagonal : std::false_type {};
+template <typename... Q1s, typename... Q2s>
+struct HasUnitlessDiagonal<StateVector<Q1s...>,
+                           StateVector<Q2s...>,
+                           std::enable_if_t<sizeof...(Q1s) == sizeof...(Q2s)>>
+    : stdx::conjunction<IsUnitlessUnit<UnitProductT<typename Q1s::Unit, typename Q2s::Unit>>...> {
+};
+}  // namespace detail
+
+template <typename... Qs>
+class StateVector {
+    static_assert(sizeof...(Qs) > 0u, "StateVector must have at least one element");
+    static_assert(stdx::conjunction<detail::IsQuantityElement<Qs>...>::value,
+                  "Every StateVector element type must be a Quantity");
+
+ public:
+    using Rep = typename detail::FirstOfT<Qs...>::Rep;
+    static_assert(stdx::conjunction<std::is_same<typename Qs::Rep, Rep>...>::value,
+                  "Every StateVector element must have the same Rep");
+
+    // The type of element `I`.
+    template <std::size_t I>
+    using Element = std::tuple_element_t<I, std::tuple<Qs...>>;
+
+    static constexpr std::size_t size() { return sizeof...(Qs); }
+
+    // A vector whose every element is zero.
+    constexpr StateVector() = default;
+
+    constexpr StateVector(Qs... qs) : values_{qs.in(typename Qs::Unit{})...} {}
+
+    template <std::size_t I>
+    constexpr Element<I> get() const {
+        return make_quantity<typename Element<I>::Unit>(values_[I]);
+    }
+
+    template <std::size_t I>
+    constexpr void set(Element<I> q) {
+        values_[I] = q.in(typename Element<I>::Unit{});
+    }
+
+    // The raw values, in the units of their elements.
+    constexpr Rep *data() { return values_; }
+    constexpr const Rep *data() const { return values_; }
+
+    constexpr StateVector &operator+=(const StateVector &other) {
+        for (std::size_t i = 0u; i < size(); ++i) {
+            values_[i] = static_cast<Rep>(values_[i] + other.values_[i]);
+        }
+        return *this;
+    }
+
+    constexpr StateVector &operator-=(const StateVector &other) {
+        for (std::size_t i = 0u; i < size(); ++i) {
+            values_[i] = static_cast<Rep>(values_[i] - other.values_[i]);
+        }
+        return *this;
+    }
+
+    friend constexpr StateVector operator+(StateVector a, const StateVector &b) { return a += b; }
+    friend constexpr StateVector operator-(StateVector a, const StateVector &b) { return a -= b; }
+
+    friend constexpr bool operator==(const StateVector &a, const StateVector &b) {
+        for (std::size_t i = 0u; i < size(); ++i) {
+            if (a.values_[i] != b.values_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=(const StateVector &a, const StateVector &b) {
+        return !(a == b);
+    }
+
+ private:
+    Rep values_[sizeof...(Qs)]{};
+};
+
+template <typename... Qs>
+struct StateVectorInverse<StateVector<Qs...>>
+    : stdx::type_identity<
+          StateVector<Quantity<UnitInverseT<typename Qs::Unit>, typename Qs::Rep>...>> {};
+
+template <typename RowVector, typename ColVector>
+class StateMatrix {
+    static_assert(std::is_same<typename RowVector::Rep, typename ColVector::Rep>::value,
+                  "The row and column StateVectors of a StateMatrix must have the same Rep");
+
+ public:
+    using Rep = typename RowVector::Rep;
+    using Rows = RowVector;
+    using Cols = ColVector;
+
+    // The type of entry `(I, J)`.
+    template <std::size_t I, std::size_t J>
+    using Element = Quantity<UnitProductT<typename RowVector::template Element<I>::Unit,
+                                          typename ColVector::template Element<J>::Unit>,
+                             Rep>;
+
+    static constexpr std::size_t rows() { return RowVector::size(); }
+    static constexpr std::size_t cols() { return ColVector::size(); }
+
+    // A matrix whose every entry is zero.
+    constexpr StateMatrix() = default;
+
+    // The identity matrix.  This only exists when every diagonal entry is unitless: for example,
+    // for a `StateMatrix<V, StateVectorInverseT<V>>`.
+    static constexpr StateMatrix identity() {
+        static_assert(detail::HasUnitlessDiagonal<RowVector, ColVector>::value,
+                      "identity() requires a square StateMatrix with unitless diagonal");
+        StateMatrix m;
+        for (std::size_t i = 0u; i < rows(); ++i) {
+            m.values_[i * cols() + i] = Rep{1};
+        }
+        return m;
+    }
+
+    template <std::size_t I, std::size_t J>
+    constexpr Element<I, J> get() const {
+        return make_quantity<typename Element<I, J>::Unit>(values_[I * cols() + J]);
+    }
+
+    template <std::size_t I, std::size_t J>
+    constexpr void set(Element<I, J> q) {
+        values_[I * cols() + J] = q.in(typename Element<I, J>::Unit{});
+    }
+
+    // The raw values, in row-major order, in the units of their entries.
+    constexpr Rep *data() { return values_; }
+    constexpr const Rep *data() const { return values_; }
+
+    constexpr StateMatrix<ColVector, RowVector> transpose() const {
+        StateMatrix<ColVector, RowVector> result;
+        for (std::size_t i = 0u; i < rows(); ++i) {
+            for (std::size_t j = 0u; j < cols(); ++j) {
+                result.data()[j * rows() + i] = values_[i * cols() + j];
+            }
+        }
+        return result;
+    }
+
+    constexpr StateMatrix &operator+=(const StateMatrix &other) {
+        for (std::size_t i = 0u; i < rows() * cols(); ++i) {
+            values_[i] = static_cast<Rep>(values_[i] + other.values_[i]);
+        }
+        return *this;
+    }
+
+    constexpr StateMatrix &operator-=(const StateMatrix &other) {
+        for (std::size_t i = 0u; i < rows() * cols(); ++i) {
+            values_[i] = static_cast<Rep>(values_[i] - other.values_[i]);
+        }
+        return *this;
+    }
+
+    friend constexpr StateMatrix operator+(StateMatrix a, const StateMatrix &b) { return a += b; }
+    friend constexpr StateMatrix operator-(StateMatrix a, const StateMatrix &b) { return a -= b; }
+
+    friend constexpr bool operator==(const StateMatrix &a, const StateMatrix &b) {
+        for (std::size_t i = 0u; i < rows() * cols(); ++i) {
+            if (a.values_[i] != b.values_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=(const StateMatrix &a, const StateMatrix &b) {
+        return !(a == b);
+    }
+
+ private:
+    Rep values_[RowVector::size() * ColVector::size()]{};
+};
+
+// The matrix whose entry `(i, j)` is `v[i] * w[j]`.
+template <typename... Q1s, typename... Q2s>
+constexpr StateMatrix<StateVector<Q1s...>, StateVector<Q2s...>> outer_product(
+    const StateVector<Q1s...> &v, const StateVector<Q2s...> &w) {
+    using Rep = typename StateVector<Q1s...>::Rep;
+    constexpr std::size_t rows = sizeof...(Q1s);
+    constexpr std::size_t cols = sizeof...(Q2s);
+
+    StateMatrix<StateVector<Q1s...>, StateVector<Q2s...>> result;
+    for (std::size_t i = 0u; i < rows; ++i) {
+        for (std::size_t j = 0u; j < cols; ++j) {
+            result.data()[i * cols + j] = static_cast<Rep>(v.data()[i] * w.data()[j]);
+        }
+    }
+    return result;
+}
+
+// Matrix-vector product.
+//
+// The units of each result element are computed at compile time; the arithmetic is on raw numbers.
+template <typename RowVector, typename ColVector, typename... Qs>
+constexpr auto operator*(const StateMatrix<RowVector, ColVector> &m, const StateVector<Qs...> &v) {
+    using Term = detail::InnerProductUnitT<ColVector, StateVector<Qs...>>;
+    using Rep = typename RowVector::Rep;
+    static_assert(std::is_same<Rep, typename StateVector<Qs...>::Rep>::value,
+                  "StateMatrix and StateVector must have the same Rep");
+
+    constexpr std::size_t rows = RowVector::size();
+    constexpr std::size_t inner = ColVector::size();
+
+    detail::ScaleStateVectorUnitsT<RowVector, Term> result;
+    for (std::size_t i = 0u; i < rows; ++i) {
+        Rep sum{0};
+        for (std::size_t k = 0u; k < inner; ++k) {
+            sum = static_cast<Rep>(sum + m.data()[i * inner + k] * v.data()[k]);
+        }
+        result.data()[i] = sum;
+    }
+    return result;
+}
+
+// Matrix-matrix product.
+//
+// The units of each result entry are computed at compile time; the arithmetic is on raw numbers.
+template <typename R1, typename C1, typename R2, typename C2>
+constexpr auto operator*(const StateMatrix<R1, C1> &a, const StateMatrix<R2, C2> &b) {
+    using Term = detail::InnerProductUnitT<C1, R2>;
+    using Rep = typename R1::Rep;
+    static_assert(std::is_same<Rep, typename R2::Rep>::value,
+                  "Multiplied StateMatrix types must have the same Rep");
+
+    constexpr std::size_t rows = R1::size();
+    constexpr std::size_t inner = C1::size();
+    constexpr std::size_t cols = C2::size();
+
+    StateMatrix<detail::ScaleStateVectorUnitsT<R1, Term>, C2> result;
+    for (std::size_t i = 0u; i < rows; ++i) {
+        for (std::size_t j = 0u; j < cols; ++j) {
+            Rep sum{0};
+            for (std::size_t k = 0u; k < inner; ++k) {
+                sum = static_cast<Rep>(sum + a.data()[i * inner + k] * b.data()[k * cols + j]);
+            }
+            result.data()[i * cols + j] = sum;
+        }
+    }
+    return result;
+}
+
+}  // namespace au
@@ -0,0 +1,183 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/state_vector.hh"
+
+#include <cstdint>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+namespace {
+
+using MetersPerSecond = decltype(Meters{} / Seconds{});
+
+using State = StateVector<QuantityD<Meters>, QuantityD<MetersPerSecond>, QuantityD<Radians>>;
+using Covariance = StateMatrix<State, State>;
+using Transition = StateMatrix<State, StateVectorInverseT<State>>;
+
+using Position = StateVector<QuantityI32<Meters>, QuantityI32<Milli<Meters>>>;
+
+}  // namespace
+
+TEST(StateVector, DefaultConstructedHasAllElementsZero) {
+    constexpr State x{};
+    EXPECT_THAT(x.get<0>(), SameTypeAndValue(meters(0.0)));
+    EXPECT_THAT(x.get<1>(), SameTypeAndValue((meters / second)(0.0)));
+    EXPECT_THAT(x.get<2>(), SameTypeAndValue(radians(0.0)));
+}
+
+TEST(StateVector, GetReturnsEachElementInItsOwnUnit) {
+    constexpr State x{meters(1.5), (meters / second)(-2.0), radians(0.25)};
+    EXPECT_THAT(x.get<0>(), SameTypeAndValue(meters(1.5)));
+    EXPECT_THAT(x.get<1>(), SameTypeAndValue((meters / second)(-2.0)));
+    EXPECT_THAT(x.get<2>(), SameTypeAndValue(radians(0.25)));
+}
+
+TEST(StateVector, ConstructorAndSetAcceptImplicitlyConvertibleQuantities) {
+    Position p{meters(2), meters(3)};
+    EXPECT_THAT(p.get<1>(), SameTypeAndValue(milli(meters)(3'000)));
+
+    p.set<0>(meters(5));
+    p.set<1>(milli(meters)(7));
+    EXPECT_THAT(p.get<0>(), SameTypeAndValue(meters(5)));
+    EXPECT_THAT(p.get<1>(), SameTypeAndValue(milli(meters)(7)));
+}
+
+TEST(StateVector, DataHoldsRawValuesContiguouslyInElementUnits) {
+    State x{meters(1.0), (meters / second)(2.0), radians(3.0)};
+    EXPECT_THAT(State::size(), 3u);
+    EXPECT_THAT(sizeof(State), sizeof(double) * 3u);
+    EXPECT_THAT((std::vector<double>{x.data(), x.data() + State::size()}),
+                ElementsAre(1.0, 2.0, 3.0));
+
+    x.data()[2] = 4.0;
+    EXPECT_THAT(x.get<2>(), SameTypeAndValue(radians(4.0)));
+}
+
+TEST(StateVector, SupportsElementwiseAdditionAndSubtraction) {
+    constexpr Position a{meters(1), milli(meters)(20)};
+    constexpr Position b{meters(3), milli(meters)(5)};
+    EXPECT_EQ(a + b, (Position{meters(4), milli(meters)(25)}));
+    EXPECT_EQ(a - b, (Position{meters(-2), milli(meters)(15)}));
+    EXPECT_NE(a, b);
+}
+
+TEST(StateVectorInverseT, InvertsEveryUnit) {
+    StaticAssertTypeEq<StateVectorInverseT<Position>,
+                       StateVector<QuantityI32<UnitInverseT<Meters>>,
+                                   QuantityI32<UnitInverseT<Milli<Meters>>>>>();
+}
+
+TEST(StateMatrix, EntryUnitsAreProductsOfRowAndColumnUnits) {
+    StaticAssertTypeEq<Covariance::Element<0, 0>, QuantityD<UnitPowerT<Meters, 2>>>();
+    StaticAssertTypeEq<Covariance::Element<0, 2>, QuantityD<UnitProductT<Meters, Radians>>>();
+    StaticAssertTypeEq<Transition::Element<0, 1>, QuantityD<Seconds>>();
+    StaticAssertTypeEq<Transition::Element<1, 1>, QuantityD<UnitProduct<>>>();
+}
+
+TEST(StateMatrix, DefaultConstructedHasAllEntriesZero) {
+    constexpr Covariance p{};
+    EXPECT_THAT((p.get<0, 0>()), SameTypeAndValue(squared(meters)(0.0)));
+    EXPECT_THAT((p.get<2, 1>()), SameTypeAndValue((radians * meters / second)(0.0)));
+}
+
+TEST(StateMatrix, SetAndGetUseRowMajorRawStorage) {
+    Covariance p{};
+    p.set<1, 2>((meters * radians / second)(0.5));
+    EXPECT_THAT((p.get<1, 2>()), SameTypeAndValue((meters * radians / second)(0.5)));
+    EXPECT_EQ(p.data()[1 * Covariance::cols() + 2], 0.5);
+    EXPECT_THAT(sizeof(Covariance), sizeof(double) * 9u);
+}
+
+TEST(StateMatrix, IdentityHasOnesOnUnitlessDiagonal) {
+    constexpr auto f = Transition::identity();
+    EXPECT_THAT((f.get<0, 0>()), SameTypeAndValue(make_quantity<UnitProduct<>>(1.0)));
+    EXPECT_THAT((f.get<0, 1>()), SameTypeAndValue(seconds(0.0)));
+    EXPECT_THAT((f.get<2, 2>()), SameTypeAndValue(make_quantity<UnitProduct<>>(1.0)));
+}
+
+TEST(StateMatrix, OuterProductGivesCovarianceOfVector) {
+    constexpr State x{meters(2.0), (meters / second)(3.0), radians(0.5)};
+    constexpr auto p = outer_product(x, x);
+    StaticAssertTypeEq<decltype(p), const Covariance>();
+    EXPECT_THAT((p.get<0, 1>()), SameTypeAndValue((meters * meters / second)(6.0)));
+    EXPECT_THAT((p.get<2, 2>()), SameTypeAndValue(squared(radians)(0.25)));
+}
+
+TEST(StateMatrix, MatrixVectorProductComputesResultUnits) {
+    auto f = Transition::identity();
+    f.set<0, 1>(seconds(0.5));
+
+    const State x{meters(1.0), (meters / second)(2.0), radians(0.5)};
+    const auto next = f * x;
+    StaticAssertTypeEq<decltype(next), const State>();
+    EXPECT_THAT(next.get<0>(), SameTypeAndValue(meters(2.0)));
+    EXPECT_THAT(next.get<1>(), SameTypeAndValue((meters / second)(2.0)));
+    EXPECT_THAT(next.get<2>(), SameTypeAndValue(radians(0.5)));
+}
+
+TEST(StateMatrix, PropagatingCovarianceKeepsItsType) {
+    auto f = Transition::identity();
+    f.set<0, 1>(seconds(2.0));
+
+    Covariance p{};
+    p.set<0, 0>(squared(meters)(1.0));
+    p.set<1, 1>(squared(meters / second)(4.0));
+
+    const auto propagated = f * p * f.transpose();
+    StaticAssertTypeEq<decltype(propagated), const Covariance>();
+    EXPECT_THAT((propagated.get<0, 0>()), SameTypeAndValue(squared(meters)(17.0)));
+    EXPECT_THAT((propagated.get<0, 1>()), SameTypeAndValue((meters * meters / second)(8.0)));
+    EXPECT_THAT((propagated.get<1, 0>()), SameTypeAndValue((meters * meters / second)(8.0)));
+    EXPECT_THAT((propagated.get<1, 1>()), SameTypeAndValue(squared(meters / second)(4.0)));
+}
+
+TEST(StateMatrix, ProductScalesRowUnitsByUnitOfTerms) {
+    using Velocity = StateVector<QuantityD<MetersPerSecond>>;
+    StateMatrix<Velocity, StateVector<QuantityD<UnitProduct<>>>> m{};
+    m.set<0, 0>((meters / second)(3.0));
+
+    const StateVector<QuantityD<Seconds>> dt{seconds(2.0)};
+    const auto dx = m * dt;
+    StaticAssertTypeEq<decltype(dx), const StateVector<QuantityD<Meters>>>();
+    EXPECT_THAT(dx.get<0>(), SameTypeAndValue(meters(6.0)));
+}
+
+TEST(StateMatrix, TransposeSwapsRowsAndColumns) {
+    Transition f{};
+    f.set<0, 1>(seconds(0.5));
+    const auto t = f.transpose();
+    StaticAssertTypeEq<decltype(t), const StateMatrix<StateVectorInverseT<State>, State>>();
+    EXPECT_THAT((t.get<1, 0>()), SameTypeAndValue(seconds(0.5)));
+    EXPECT_THAT((t.get<0, 1>()), SameTypeAndValue(make_quantity<UnitInverseT<Seconds>>(0.0)));
+}
+
+TEST(StateMatrix, SupportsEntrywiseAdditionAndSubtraction) {
+    constexpr State x{meters(1.0), (meters / second)(2.0), radians(3.0)};
+    constexpr auto p = outer_product(x, x);
+    EXPECT_EQ(p + p - p, p);
+    EXPECT_NE(p + p, p);
+}
+
+}  // namespace au
@@ -0,0 +1,96 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace au {
+namespace stdx {
+
+// Source: adapted from (https://en.cppreference.com/w/cpp/container/span).
+//
+// We only support the dynamic extent, and only the subset of the API which we actually use.
+template <class T>
+class span {
+    // A container `C` (including another `span`) is viewable as a `span<T>` if its `data()` is a
+    // pointer we can convert to `T*` without changing the element type (other than adding `const`).
+    template <class C>
+    using DataPointer = decltype(std::declval<C &>().data());
+    template <class C>
+    using EnableIfCompatibleContainer = std::enable_if_t<
+        std::is_convertible<std::remove_pointer_t<DataPointer<C>> (*)[], T (*)[]>::value>;
+
+ public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T *data, size_type size) noexcept : data_{data}, size_{size} {}
+
+    template <std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept  // NOLINT(runtime/explicit)
+        : data_{arr}, size_{N} {}
+
+    template <class C, typename = EnableIfCompatibleContainer<C>>
+    constexpr span(C &c)  // NOLINT(runtime/explicit)
+        : data_{c.data()}, size_{c.size()} {}
+
+    template <class C, typename = EnableIfCompatibleContainer<const C>>
+    constexpr span(const C &c)  // NOLINT(runtime/explicit)
+        : data_{c.data()}, size_{c.size()} {}
+
+    constexpr pointer data() const noexcept { return data_; }
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0u; }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    constexpr reference operator[](size_type i) const { return data_[i]; }
+
+    constexpr span first(size_type count) const { return {data_, count}; }
+    constexpr span subspan(size_type offset, size_type count) const {
+        return {data_ + offset, count};
+    }
+
+ private:
+    T *data_ = nullptr;
+    size_type size_ = 0u;
+};
+
+// C++14 has no class template argument deduction, so we provide `make_span()` to stand in for the
+// deduction guides of `std::span`.
+template <class T, std::size_t N>
+constexpr span<T> make_span(T (&arr)[N]) noexcept {
+    return span<T>{arr};
+}
+template <class C>
+constexpr auto make_span(C &c) -> span<std::remove_pointer_t<decltype(c.data())>> {
+    return {c.data(), c.size()};
+}
+template <class C>
+constexpr auto make_span(const C &c) -> span<std::remove_pointer_t<decltype(c.data())>> {
+    return {c.data(), c.size()};
+}
+
+}  // namespace stdx
+}  // namespace au
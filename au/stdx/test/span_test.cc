@@ -0,0 +1,78 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/stdx/span.hh"
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace au {
+namespace stdx {
+
+TEST(Span, DefaultConstructedIsEmpty) {
+    constexpr span<int> s{};
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.size(), 0u);
+}
+
+TEST(Span, ViewsVectorWithoutCopying) {
+    std::vector<int> v{1, 2, 3};
+    span<int> s{v};
+    EXPECT_EQ(s.data(), v.data());
+    EXPECT_EQ(s.size(), 3u);
+
+    s[1] = 5;
+    EXPECT_EQ(v[1], 5);
+}
+
+TEST(Span, CanAddConstButNotRemoveIt) {
+    EXPECT_TRUE((std::is_convertible<std::vector<int> &, span<const int>>::value));
+    EXPECT_TRUE((std::is_convertible<span<int>, span<const int>>::value));
+    EXPECT_FALSE((std::is_convertible<const std::vector<int> &, span<int>>::value));
+    EXPECT_FALSE((std::is_convertible<span<const int>, span<int>>::value));
+}
+
+TEST(Span, CannotChangeElementType) {
+    EXPECT_FALSE((std::is_convertible<std::vector<int> &, span<long>>::value));
+    EXPECT_FALSE((std::is_convertible<std::vector<char> &, span<int>>::value));
+}
+
+TEST(Span, SupportsRangeBasedFor) {
+    const std::array<int, 3> a{{1, 2, 3}};
+    int sum = 0;
+    for (const int x : span<const int>{a}) {
+        sum += x;
+    }
+    EXPECT_EQ(sum, 6);
+}
+
+TEST(Span, SubspanRefersToSameElements) {
+    int arr[] = {1, 2, 3, 4};
+    const auto s = make_span(arr).subspan(1u, 2u);
+    ASSERT_EQ(s.size(), 2u);
+    EXPECT_EQ(&s[0], &arr[1]);
+    EXPECT_EQ(&s.first(1u)[0], &arr[1]);
+}
+
+TEST(MakeSpan, DeducesConstnessFromContainer) {
+    std::vector<int> v{1, 2, 3};
+    const std::vector<int> &cv = v;
+    EXPECT_TRUE((std::is_same<decltype(make_span(v)), span<int>>::value));
+    EXPECT_TRUE((std::is_same<decltype(make_span(cv)), span<const int>>::value));
+}
+
+}  // namespace stdx
+}  // namespace au
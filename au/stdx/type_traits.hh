@@ -16,6 +16,20 @@
 
 #include <type_traits>
 
+// `stdx::is_constant_evaluated()` needs compiler support, which C++14 compilers don't all have.  We
+// define `AU_STDX_HAS_IS_CONSTANT_EVALUATED` exactly when it is available.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define AU_STDX_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+#define AU_STDX_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+#if defined(_MSC_VER) && _MSC_VER >= 1925
+#define AU_STDX_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+
 namespace au {
 namespace stdx {
 
@@ -61,5 +75,10 @@ using remove_cvref_t = typename remove_cvref<T>::type;
 template <class...>
 using void_t = void;
 
+#ifdef AU_STDX_HAS_IS_CONSTANT_EVALUATED
+// Source: adapted from (https://en.cppreference.com/w/cpp/types/is_constant_evaluated).
+constexpr bool is_constant_evaluated() noexcept { return __builtin_is_constant_evaluated(); }
+#endif
+
 }  // namespace stdx
 }  // namespace au
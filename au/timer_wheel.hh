@@ -0,0 +1,337 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "au/chrono_interop.hh"
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/unit_of_measure.hh"
+#include "au/units/seconds.hh"
+
+namespace au {
+
+// A handle to a timer in a `TimerWheel`, which can be used to cancel it.
+struct TimerHandle {
+    uint32_t index;
+    uint32_t generation;
+};
+
+// `TimerWheel<T, TickUnit>`: a hierarchical timer wheel, holding values of type `T` until their
+// deadlines pass.
+//
+// Time advances in whole ticks of `TickUnit` (for example, `Milli<Seconds>`).  Deadlines and delays
+// can be in any time unit: we convert each one to a tick count by a single integer conversion whose
+// factor is computed at compile time, rounding _up_, so that no timer ever fires early.
+//
+// The wheel has `NumLevels` levels of `2^SlotBits` slots each.  Level `L` holds timers which are
+// due in less than `2^(SlotBits * (L + 1))` ticks; as time passes, timers move ("cascade") down to
+// finer levels, until they fire from level 0.  Scheduling and cancelling are O(1).  Timers due
+// beyond the range of the top level are held there, and re-sorted each time they cascade.
+template <typename T, typename TickUnitT, std::size_t NumLevels = 4u, std::size_t SlotBits = 8u>
+class TimerWheel {
+    static_assert(HasSameDimension<TickUnitT, Seconds>::value, "TickUnit must be a unit of time");
+    static_assert(NumLevels > 0u && SlotBits > 0u, "TimerWheel needs at least one slot per level");
+    static_assert(NumLevels * SlotBits < 64u, "TimerWheel range must fit in 64 bits");
+
+ public:
+    using TickUnit = TickUnitT;
+    using TimePoint = QuantityPoint<TickUnit, int64_t>;
+    using Duration = Quantity<TickUnit, int64_t>;
+
+    // Start at the last whole tick at or before `start`.
+    template <typename U, typename R>
+    explicit TimerWheel(QuantityPoint<U, R> start)
+        : now_{static_cast<uint64_t>(floor_to_ticks(start))} {
+        heads_.fill(NONE);
+    }
+    template <typename Clock, typename Dur>
+    explicit TimerWheel(std::chrono::time_point<Clock, Dur> start)
+        : TimerWheel{since_epoch(start)} {}
+
+    // The latest tick which we have advanced to.
+    TimePoint now() const { return make_quantity_point<TickUnit>(static_cast<int64_t>(now_)); }
+
+    // The number of pending timers.
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0u; }
+
+    // Schedule `value` to fire at the first tick at or after `deadline`.
+    //
+    // A timer whose deadline has already passed fires on the next tick.
+    template <typename U, typename R>
+    TimerHandle schedule_at(QuantityPoint<U, R> deadline, T value) {
+        return insert_new(ceil_to_ticks(deadline), std::move(value));
+    }
+    template <typename Clock, typename Dur>
+    TimerHandle schedule_at(std::chrono::time_point<Clock, Dur> deadline, T value) {
+        return schedule_at(since_epoch(deadline), std::move(value));
+    }
+
+    // Schedule `value` to fire at the first tick at least `delay` after `now()`.
+    template <typename U, typename R>
+    TimerHandle schedule_after(Quantity<U, R> delay, T value) {
+        return insert_new(static_cast<int64_t>(now_) + ceil_to_ticks(delay), std::move(value));
+    }
+
+    // Cancel a pending timer, and return whether it was still pending.
+    bool cancel(TimerHandle handle) {
+        if (handle.index >= nodes_.size()) {
+            return false;
+        }
+        Node &node = nodes_[handle.index];
+        if (node.slot == NONE || node.generation != handle.generation) {
+            return false;
+        }
+        unlink(handle.index);
+        release(handle.index);
+        return true;
+    }
+
+    // Advance to the last whole tick at or before `t`, calling `on_expire(T&&)` for every timer
+    // which fires, in order of their deadline ticks.
+    //
+    // `on_expire` may schedule or cancel timers.  Moving backwards in time does nothing.
+    template <typename U, typename R, typename F>
+    void advance_to(QuantityPoint<U, R> t, F &&on_expire) {
+        const int64_t target = floor_to_ticks(t);
+        while (static_cast<int64_t>(now_) < target) {
+            if (size_ == 0u) {
+                now_ = static_cast<uint64_t>(target);
+                return;
+            }
+            tick(on_expire);
+        }
+    }
+    template <typename Clock, typename Dur, typename F>
+    void advance_to(std::chrono::time_point<Clock, Dur> t, F &&on_expire) {
+        advance_to(since_epoch(t), std::forward<F>(on_expire));
+    }
+
+ private:
+    static constexpr uint32_t NONE = ~uint32_t{0};
+    static constexpr std::size_t SLOTS_PER_LEVEL = std::size_t{1} << SlotBits;
+    static constexpr uint64_t SLOT_MASK = SLOTS_PER_LEVEL - 1u;
+    static constexpr uint64_t RANGE = uint64_t{1} << (SlotBits * NumLevels);
+
+    struct Node {
+        T value;
+        uint64_t deadline;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t slot;
+        uint32_t generation;
+    };
+
+    // Convert a time point (or duration) to a tick count, rounding up or down.
+    //
+    // For integral reps, we convert to a unit which evenly divides both input and tick units, and
+    // then divide by the (compile-time constant) number of these units per tick.  For floating
+    // point reps, we convert to ticks in the input's own rep, and round before narrowing.
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(QuantityPoint<U, R> p) {
+        return ceil_to_ticks(p, std::is_floating_point<R>{});
+    }
+    template <typename U, typename R>
+    static int64_t floor_to_ticks(QuantityPoint<U, R> p) {
+        return floor_to_ticks(p, std::is_floating_point<R>{});
+    }
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(Quantity<U, R> q) {
+        return ceil_to_ticks(q, std::is_floating_point<R>{});
+    }
+
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(QuantityPoint<U, R> p, std::false_type /* is_float */) {
+        using Fine = CommonPointUnitT<U, TickUnit>;
+        constexpr int64_t n = fine_per_tick<Fine>();
+        return ceil_div(p.template in<int64_t>(Fine{}), n);
+    }
+    template <typename U, typename R>
+    static int64_t floor_to_ticks(QuantityPoint<U, R> p, std::false_type /* is_float */) {
+        using Fine = CommonPointUnitT<U, TickUnit>;
+        constexpr int64_t n = fine_per_tick<Fine>();
+        return floor_div(p.template in<int64_t>(Fine{}), n);
+    }
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(Quantity<U, R> q, std::false_type /* is_float */) {
+        using Fine = CommonUnitT<U, TickUnit>;
+        constexpr int64_t n = fine_per_tick<Fine>();
+        return ceil_div(q.template in<int64_t>(Fine{}), n);
+    }
+
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(QuantityPoint<U, R> p, std::true_type /* is_float */) {
+        return ceil_float(p.template in<R>(TickUnit{}));
+    }
+    template <typename U, typename R>
+    static int64_t floor_to_ticks(QuantityPoint<U, R> p, std::true_type /* is_float */) {
+        return floor_float(p.template in<R>(TickUnit{}));
+    }
+    template <typename U, typename R>
+    static int64_t ceil_to_ticks(Quantity<U, R> q, std::true_type /* is_float */) {
+        return ceil_float(q.template in<R>(TickUnit{}));
+    }
+
+    template <typename Fine>
+    static constexpr int64_t fine_per_tick() {
+        return make_quantity<TickUnit>(int64_t{1}).in(Fine{});
+    }
+
+    static constexpr int64_t ceil_div(int64_t x, int64_t n) {
+        return x / n + ((x % n > 0) ? 1 : 0);
+    }
+    static constexpr int64_t floor_div(int64_t x, int64_t n) {
+        return x / n - ((x % n < 0) ? 1 : 0);
+    }
+
+    // Round a floating point tick count, without depending on `<cmath>`.
+    template <typename F>
+    static constexpr int64_t ceil_float(F x) {
+        return static_cast<int64_t>(x) + ((static_cast<F>(static_cast<int64_t>(x)) < x) ? 1 : 0);
+    }
+    template <typename F>
+    static constexpr int64_t floor_float(F x) {
+        return static_cast<int64_t>(x) - ((static_cast<F>(static_cast<int64_t>(x)) > x) ? 1 : 0);
+    }
+
+    template <typename Clock, typename Dur>
+    static auto since_epoch(std::chrono::time_point<Clock, Dur> t) {
+        const auto d = as_quantity(t.time_since_epoch());
+        using U = typename decltype(d)::Unit;
+        return make_quantity_point<U>(d.in(U{}));
+    }
+
+    TimerHandle insert_new(int64_t deadline, T value) {
+        uint32_t index;
+        if (free_ != NONE) {
+            index = free_;
+            free_ = nodes_[index].next;
+            nodes_[index].value = std::move(value);
+        } else {
+            index = static_cast<uint32_t>(nodes_.size());
+            nodes_.push_back(Node{std::move(value), 0u, NONE, NONE, NONE, 0u});
+        }
+
+        // Deadlines which have already passed fire on the next tick.
+        const uint64_t next_tick = now_ + 1u;
+        const uint64_t d = static_cast<uint64_t>(deadline);
+        nodes_[index].deadline = (static_cast<int64_t>(d - next_tick) < 0) ? next_tick : d;
+
+        link(index);
+        ++size_;
+        return TimerHandle{index, nodes_[index].generation};
+    }
+
+    // Put a node into the slot for its deadline, relative to `now_`.
+    void link(uint32_t index) {
+        Node &node = nodes_[index];
+        const uint64_t delta = node.deadline - now_;
+        const uint64_t placed = (delta < RANGE) ? node.deadline : (now_ + RANGE - 1u);
+        const uint64_t placed_delta = placed - now_;
+
+        std::size_t level = 0u;
+        while ((placed_delta >> (SlotBits * (level + 1u))) != 0u) {
+            ++level;
+        }
+        const auto slot = static_cast<uint32_t>(
+            level * SLOTS_PER_LEVEL + ((placed >> (SlotBits * level)) & SLOT_MASK));
+
+        node.slot = slot;
+        node.prev = NONE;
+        node.next = heads_[slot];
+        if (node.next != NONE) {
+            nodes_[node.next].prev = index;
+        }
+        heads_[slot] = index;
+    }
+
+    void unlink(uint32_t index) {
+        Node &node = nodes_[index];
+        if (node.prev != NONE) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            heads_[node.slot] = node.next;
+        }
+        if (node.next != NONE) {
+            nodes_[node.next].prev = node.prev;
+        }
+    }
+
+    void release(uint32_t index) {
+        Node &node = nodes_[index];
+        node.slot = NONE;
+        ++node.generation;
+        node.next = free_;
+        free_ = index;
+        --size_;
+    }
+
+    template <typename F>
+    void tick(F &on_expire) {
+        ++now_;
+
+        // Each time a level's index wraps around to zero, cascade the current slot of the next
+        // level down.  Cascade coarser levels first, so their timers can keep falling.
+        std::size_t num_cascades = 0u;
+        while (num_cascades + 1u < NumLevels &&
+               ((now_ >> (SlotBits * (num_cascades + 1u))) << (SlotBits * (num_cascades + 1u))) ==
+                   now_) {
+            ++num_cascades;
+        }
+        for (std::size_t level = num_cascades; level > 0u; --level) {
+            cascade(level);
+        }
+
+        // Pop one timer at a time, because `on_expire` may schedule or cancel timers.
+        const auto slot = static_cast<std::size_t>(now_ & SLOT_MASK);
+        while (heads_[slot] != NONE) {
+            const uint32_t index = heads_[slot];
+            unlink(index);
+            T value = std::move(nodes_[index].value);
+            release(index);
+            on_expire(std::move(value));
+        }
+    }
+
+    void cascade(std::size_t level) {
+        const auto slot = level * SLOTS_PER_LEVEL + ((now_ >> (SlotBits * level)) & SLOT_MASK);
+        uint32_t index = heads_[slot];
+        heads_[slot] = NONE;
+        while (index != NONE) {
+            const uint32_t next = nodes_[index].next;
+            link(index);
+            index = next;
+        }
+    }
+
+    uint64_t now_;
+    std::size_t size_ = 0u;
+    uint32_t free_ = NONE;
+    std::vector<Node> nodes_;
+    std::array<uint32_t, NumLevels * SLOTS_PER_LEVEL> heads_;
+};
+
+template <typename T, typename TickUnitT, std::size_t NumLevels, std::size_t SlotBits>
+constexpr uint32_t TimerWheel<T, TickUnitT, NumLevels, SlotBits>::NONE;
+
+}  // namespace au
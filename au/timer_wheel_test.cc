@@ -0,0 +1,243 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/timer_wheel.hh"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/minutes.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+namespace au {
+namespace {
+
+using Ms = Milli<Seconds>;
+
+template <typename U>
+QuantityPoint<U, int64_t> at(U, int64_t value) {
+    return make_quantity_point<U>(value);
+}
+
+// Advance `wheel` to `t`, and return the values of every timer which fired.
+template <typename Wheel, typename TimePoint>
+std::vector<int> advance_and_collect(Wheel &wheel, TimePoint t) {
+    std::vector<int> fired;
+    wheel.advance_to(t, [&fired](int x) { fired.push_back(x); });
+    return fired;
+}
+
+}  // namespace
+
+TEST(TimerWheel, StartsEmptyAtGivenTick) {
+    const TimerWheel<int, Ms> wheel{at(Seconds{}, 2)};
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_THAT(wheel.now(), SameTypeAndValue(make_quantity_point<Ms>(int64_t{2'000})));
+}
+
+TEST(TimerWheel, FiresTimersWhenDeadlinePasses) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Ms{}, 10), 1);
+    wheel.schedule_at(at(Ms{}, 5), 2);
+    EXPECT_EQ(wheel.size(), 2u);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 4)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 5)), ElementsAre(2));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 20)), ElementsAre(1));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, FiresInDeadlineOrderAcrossLevels) {
+    TimerWheel<int, Ms, 3u, 4u> wheel{at(Ms{}, 3)};
+    wheel.schedule_at(at(Ms{}, 3'000), 5);
+    wheel.schedule_at(at(Ms{}, 200), 4);
+    wheel.schedule_at(at(Ms{}, 17), 3);
+    wheel.schedule_at(at(Ms{}, 16), 2);
+    wheel.schedule_at(at(Ms{}, 4), 1);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 10'000)), ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(TimerWheel, DeadlineBeyondRangeFiresOnTime) {
+    // Range is 2^(2 * 3) = 64 ticks.
+    TimerWheel<int, Ms, 2u, 3u> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Ms{}, 1'000), 1);
+    wheel.schedule_at(at(Ms{}, 1'100), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 999)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1'000)), ElementsAre(1));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1'099)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1'100)), ElementsAre(2));
+}
+
+TEST(TimerWheel, RoundsDeadlinesUpToWholeTicks) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Micro<Seconds>{}, 2'001), 1);
+    wheel.schedule_at(at(Micro<Seconds>{}, 2'000), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 2)), ElementsAre(2));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 3)), ElementsAre(1));
+}
+
+TEST(TimerWheel, RoundsFloatingPointDeadlinesUpToWholeTicks) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(make_quantity_point<Seconds>(0.0015), 1);
+    wheel.schedule_at(make_quantity_point<Seconds>(0.0025f), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 2)), ElementsAre(1));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 3)), ElementsAre(2));
+}
+
+TEST(TimerWheel, RoundsFloatingPointDelaysUpToWholeTicks) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_after(seconds(0.0015), 1);
+    wheel.schedule_after(milli(seconds)(-0.5), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1)), ElementsAre(2));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 2)), ElementsAre(1));
+}
+
+TEST(TimerWheel, AdvancesOnlyToWholeTicksForFloatingPointTimes) {
+    TimerWheel<int, Ms> wheel{make_quantity_point<Seconds>(-0.0005)};
+    EXPECT_THAT(wheel.now(), SameTypeAndValue(make_quantity_point<Ms>(int64_t{-1})));
+
+    wheel.schedule_at(make_quantity_point<Seconds>(1.0005), 1);
+    EXPECT_THAT(advance_and_collect(wheel, make_quantity_point<Seconds>(1.0009)), IsEmpty());
+    EXPECT_THAT(wheel.now(), SameTypeAndValue(make_quantity_point<Ms>(int64_t{1'000})));
+    EXPECT_THAT(advance_and_collect(wheel, make_quantity_point<Seconds>(1.0015)), ElementsAre(1));
+}
+
+TEST(TimerWheel, AdvancesOnlyToWholeTicks) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Ms{}, 2), 1);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Micro<Seconds>{}, 1'999)), IsEmpty());
+    EXPECT_THAT(wheel.now(), SameTypeAndValue(make_quantity_point<Ms>(int64_t{1})));
+    EXPECT_THAT(advance_and_collect(wheel, at(Micro<Seconds>{}, 2'000)), ElementsAre(1));
+}
+
+TEST(TimerWheel, ScheduleAfterIsRelativeToNow) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    EXPECT_THAT(advance_and_collect(wheel, at(Seconds{}, 1)), IsEmpty());
+
+    wheel.schedule_after(minutes(int64_t{1}), 1);
+    wheel.schedule_after(micro(seconds)(int64_t{1}), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1'001)), ElementsAre(2));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 60'999)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 61'000)), ElementsAre(1));
+}
+
+TEST(TimerWheel, PastDeadlinesFireOnNextTick) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 100)};
+    wheel.schedule_at(at(Ms{}, 50), 1);
+    wheel.schedule_after(milli(seconds)(int64_t{-5}), 2);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 100)), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 101)), UnorderedElementsAre(1, 2));
+}
+
+TEST(TimerWheel, CancelledTimersDoNotFire) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Ms{}, 5), 1);
+    const auto handle = wheel.schedule_at(at(Ms{}, 5), 2);
+    wheel.schedule_at(at(Ms{}, 5), 3);
+
+    EXPECT_TRUE(wheel.cancel(handle));
+    EXPECT_FALSE(wheel.cancel(handle));
+    EXPECT_EQ(wheel.size(), 2u);
+
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 5)), UnorderedElementsAre(1, 3));
+}
+
+TEST(TimerWheel, StaleHandleDoesNotCancelReusedTimer) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    const auto stale = wheel.schedule_at(at(Ms{}, 1), 1);
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 1)), ElementsAre(1));
+
+    wheel.schedule_at(at(Ms{}, 2), 2);
+    EXPECT_FALSE(wheel.cancel(stale));
+    EXPECT_THAT(advance_and_collect(wheel, at(Ms{}, 2)), ElementsAre(2));
+}
+
+TEST(TimerWheel, CallbackCanScheduleAndCancel) {
+    TimerWheel<int, Ms> wheel{at(Ms{}, 0)};
+    const auto doomed = wheel.schedule_at(at(Ms{}, 3), 99);
+    wheel.schedule_at(at(Ms{}, 1), 1);
+
+    std::vector<int> fired;
+    wheel.advance_to(at(Ms{}, 10), [&](int x) {
+        fired.push_back(x);
+        if (x == 1) {
+            wheel.cancel(doomed);
+            wheel.schedule_after(milli(seconds)(int64_t{1}), 2);
+        }
+    });
+    EXPECT_THAT(fired, ElementsAre(1, 2));
+}
+
+TEST(TimerWheel, SupportsMoveOnlyValues) {
+    TimerWheel<std::unique_ptr<int>, Ms> wheel{at(Ms{}, 0)};
+    wheel.schedule_at(at(Ms{}, 1), std::make_unique<int>(7));
+
+    int result = 0;
+    wheel.advance_to(at(Ms{}, 1), [&](std::unique_ptr<int> p) { result = *p; });
+    EXPECT_EQ(result, 7);
+}
+
+TEST(TimerWheel, AcceptsChronoTimePoints) {
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::time_point{} + std::chrono::hours{1};
+    TimerWheel<int, Ms> wheel{t0};
+
+    wheel.schedule_at(t0 + std::chrono::microseconds{1'500}, 1);
+    EXPECT_THAT(advance_and_collect(wheel, t0 + std::chrono::milliseconds{1}), IsEmpty());
+    EXPECT_THAT(advance_and_collect(wheel, t0 + std::chrono::milliseconds{2}), ElementsAre(1));
+}
+
+TEST(TimerWheel, MatchesSortedDeadlinesForRandomTimers) {
+    TimerWheel<int, Ms, 3u, 4u> wheel{at(Ms{}, 0)};
+    std::mt19937 rng{42u};
+    std::uniform_int_distribution<int> deadline_dist{1, 10'000};
+
+    std::vector<std::pair<int64_t, int>> expected;
+    for (int i = 0; i < 500; ++i) {
+        const int64_t deadline = deadline_dist(rng);
+        wheel.schedule_at(at(Ms{}, deadline), i);
+        expected.emplace_back(deadline, i);
+    }
+
+    std::vector<std::pair<int64_t, int>> actual;
+    for (int64_t t = 0; t <= 10'000; t += 37) {
+        wheel.advance_to(at(Ms{}, t), [&](int x) { actual.emplace_back(wheel.now().in(Ms{}), x); });
+    }
+    wheel.advance_to(at(Ms{}, 10'000),
+                     [&](int x) { actual.emplace_back(wheel.now().in(Ms{}), x); });
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+}
+
+}  // namespace au
@@ -0,0 +1,172 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "au/chrono_interop.hh"
+#include "au/quantity.hh"
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+// `TokenBucket<Quantity<U, R>, RateUnit, Clock>`: a lock-free rate limiter for quantities.
+//
+// The bucket holds at most `capacity` tokens (for example, bytes), and refills continuously at
+// `rate` (for example, bytes per second), measured lazily against `Clock`.  A request for `n`
+// tokens either succeeds and removes them, or fails and changes nothing.
+//
+// We store a single atomic value: the clock time at which the bucket would next be full (the
+// "theoretical arrival time" of the Generic Cell Rate Algorithm).  Each request converts its tokens
+// to clock ticks, and updates this time with a compare-exchange loop.  The conversion between the
+// token unit, the rate unit, and the clock's tick period is a constant, which we fold at compile
+// time; the only runtime division is by the value of the rate itself.  Costs are rounded _up_ to
+// a whole tick, so the bucket never grants tokens faster than `rate`.
+template <typename Q, typename RateUnit, typename Clock = std::chrono::steady_clock>
+class TokenBucket;
+
+template <typename UnitT, typename RepT, typename RateUnitT, typename ClockT>
+class TokenBucket<Quantity<UnitT, RepT>, RateUnitT, ClockT> {
+    static_assert(std::is_integral<RepT>::value, "TokenBucket requires integral Rep");
+
+ public:
+    using Rep = RepT;
+    using Unit = UnitT;
+    using RateUnit = RateUnitT;
+    using Clock = ClockT;
+    using QuantityType = Quantity<Unit, Rep>;
+    using RateType = Quantity<RateUnit, Rep>;
+    using TimePoint = typename Clock::time_point;
+
+ private:
+    using Ticks = CorrespondingQuantityT<typename Clock::duration>;
+    using TickUnit = typename Ticks::Unit;
+    using TickRep = typename Ticks::Rep;
+
+    // The number of tokens which one tick of the clock buys at one unit of the rate.
+    using TokensPerTickUnit = UnitProductT<RateUnit, TickUnit>;
+    static_assert(HasSameDimension<Unit, TokensPerTickUnit>::value,
+                  "Rate must have the dimensions of tokens per unit time");
+
+    // A unit in which both token counts and tokens-per-tick are integers.
+    using CalcUnit = CommonUnitT<Unit, TokensPerTickUnit>;
+
+    // Token counts in `CalcUnit`, and tick counts, must both fit in their reps.
+    static constexpr std::uintmax_t MAX_CALC_TOKENS =
+        (static_cast<std::uintmax_t>(std::numeric_limits<Rep>::max()) <
+         static_cast<std::uintmax_t>(std::numeric_limits<TickRep>::max()))
+            ? static_cast<std::uintmax_t>(std::numeric_limits<Rep>::max())
+            : static_cast<std::uintmax_t>(std::numeric_limits<TickRep>::max());
+    static constexpr std::uintmax_t CALC_PER_TOKEN =
+        get_value<std::uintmax_t>(unit_ratio(Unit{}, CalcUnit{}));
+
+ public:
+    // The largest capacity which we can represent.
+    //
+    // We count tokens internally in a unit fine enough to hold a whole number of tokens per clock
+    // tick (for example, nanobytes, for bytes per second and a nanosecond clock), so this can be
+    // much smaller than the largest value of `Rep`.  For that example, with `uint64_t`, it's about
+    // 9.2 GB.
+    static constexpr QuantityType max_capacity() {
+        return make_quantity<Unit>(static_cast<Rep>(MAX_CALC_TOKENS / CALC_PER_TOKEN));
+    }
+
+    // Construct a full bucket.  `rate` must be positive.
+    //
+    // A `capacity` above `max_capacity()` is reduced to `max_capacity()`; check `capacity()`.
+    TokenBucket(QuantityType capacity, RateType rate, TimePoint now = Clock::now())
+        : tokens_per_tick_{make_quantity<TokensPerTickUnit>(rate.in(RateUnit{})).in(CalcUnit{})},
+          capacity_{capacity < max_capacity() ? capacity : max_capacity()},
+          rate_{rate},
+          burst_ticks_{ticks_for(capacity_)},
+          full_at_{ticks_since_epoch(now)} {}
+
+    TokenBucket(const TokenBucket &) = delete;
+    TokenBucket &operator=(const TokenBucket &) = delete;
+
+    // Take `n` tokens if they are available, and return whether we did.
+    //
+    // Requests for more than `capacity()`, or for a negative number of tokens, can never succeed.
+    bool try_acquire(QuantityType n, TimePoint now = Clock::now()) noexcept {
+        // A negative cost would move `full_at_` backwards, adding tokens.  The upper bound also keeps
+        // `n`, in `CalcUnit`, from overflowing.
+        if (n < ZERO || n > capacity_) {
+            return false;
+        }
+
+        const TickRep now_ticks = ticks_since_epoch(now);
+        const TickRep cost = ticks_for(n);
+
+        TickRep full_at = full_at_.load(std::memory_order_relaxed);
+        TickRep new_full_at;
+        do {
+            new_full_at = (full_at > now_ticks ? full_at : now_ticks) + cost;
+            if (new_full_at - now_ticks > burst_ticks_) {
+                return false;
+            }
+        } while (!full_at_.compare_exchange_weak(full_at, new_full_at, std::memory_order_relaxed));
+        return true;
+    }
+
+    // The tokens available at `now`, rounded down.
+    QuantityType available(TimePoint now = Clock::now()) const noexcept {
+        const TickRep deficit = full_at_.load(std::memory_order_relaxed) - ticks_since_epoch(now);
+        if (deficit <= 0) {
+            return capacity_;
+        }
+        if (deficit >= burst_ticks_) {
+            return make_quantity<Unit>(Rep{0});
+        }
+        return tokens_for(burst_ticks_ - deficit);
+    }
+
+    QuantityType capacity() const noexcept { return capacity_; }
+    RateType rate() const noexcept { return rate_; }
+
+ private:
+    static TickRep ticks_since_epoch(TimePoint t) noexcept {
+        return as_quantity(t.time_since_epoch()).in(TickUnit{});
+    }
+
+    // The ticks it takes to earn `n` tokens, rounded up.
+    TickRep ticks_for(QuantityType n) const noexcept {
+        const Rep tokens = n.in(CalcUnit{});
+        return static_cast<TickRep>(tokens / tokens_per_tick_ +
+                                    (tokens % tokens_per_tick_ != Rep{0} ? 1 : 0));
+    }
+
+    // The tokens earned in `ticks`, rounded down.
+    QuantityType tokens_for(TickRep ticks) const noexcept {
+        return make_quantity<CalcUnit>(static_cast<Rep>(ticks) * tokens_per_tick_)
+            .coerce_as(Unit{});
+    }
+
+    Rep tokens_per_tick_;
+    QuantityType capacity_;
+    RateType rate_;
+    TickRep burst_ticks_;
+    std::atomic<TickRep> full_at_;
+};
+
+template <typename UnitT, typename RepT, typename RateUnitT, typename ClockT>
+constexpr std::uintmax_t TokenBucket<Quantity<UnitT, RepT>, RateUnitT, ClockT>::MAX_CALC_TOKENS;
+template <typename UnitT, typename RepT, typename RateUnitT, typename ClockT>
+constexpr std::uintmax_t TokenBucket<Quantity<UnitT, RepT>, RateUnitT, ClockT>::CALC_PER_TOKEN;
+
+}  // namespace au
@@ -0,0 +1,169 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/token_bucket.hh"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/bits.hh"
+#include "au/units/bytes.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using Instant = std::chrono::steady_clock::time_point;
+
+constexpr auto T0 = Instant{} + std::chrono::hours{1};
+
+using ByteBucket = TokenBucket<QuantityU64<Bytes>, UnitQuotientT<Bytes, Seconds>>;
+
+// A clock which ticks once per millisecond, to check conversions to a coarser period.
+struct MillisecondClock {
+    using rep = int64_t;
+    using period = std::milli;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<MillisecondClock>;
+    static constexpr bool is_steady = true;
+    static time_point now() { return time_point{}; }
+};
+
+}  // namespace
+
+TEST(TokenBucket, StartsFull) {
+    const ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{1'500})));
+}
+
+TEST(TokenBucket, CannotTakeMoreThanAvailable) {
+    ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+    EXPECT_TRUE(bucket.try_acquire(bytes(uint64_t{1'000}), T0));
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{501}), T0));
+    EXPECT_TRUE(bucket.try_acquire(bytes(uint64_t{500}), T0));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{0})));
+}
+
+TEST(TokenBucket, FailedRequestChangesNothing) {
+    ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{1'501}), T0));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{1'500})));
+}
+
+TEST(TokenBucket, RefillsAtRate) {
+    ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+    ASSERT_TRUE(bucket.try_acquire(bytes(uint64_t{1'500}), T0));
+
+    EXPECT_THAT(bucket.available(T0 + nanoseconds{250'000}),
+                SameTypeAndValue(bytes(uint64_t{250})));
+    EXPECT_THAT(bucket.available(T0 + milliseconds{1}), SameTypeAndValue(bytes(uint64_t{1'000})));
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{1'001}), T0 + milliseconds{1}));
+    EXPECT_TRUE(bucket.try_acquire(bytes(uint64_t{1'000}), T0 + milliseconds{1}));
+}
+
+TEST(TokenBucket, RefillStopsAtCapacity) {
+    ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+    ASSERT_TRUE(bucket.try_acquire(bytes(uint64_t{1'500}), T0));
+    EXPECT_THAT(bucket.available(T0 + std::chrono::seconds{10}),
+                SameTypeAndValue(bytes(uint64_t{1'500})));
+}
+
+TEST(TokenBucket, RejectsRequestsLargerThanCapacity) {
+    ByteBucket bucket{bytes(uint64_t{1'500}), (bytes / second)(uint64_t{1'000'000}), T0};
+
+    // In nanobytes, this would wrap around to about 1 byte.
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{18'446'744'074}), T0));
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{1'501}), T0 + std::chrono::hours{1}));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{1'500})));
+}
+
+TEST(TokenBucket, RejectsNegativeRequests) {
+    TokenBucket<QuantityI64<Bytes>, UnitQuotientT<Bytes, Seconds>> bucket{
+        bytes(int64_t{1'500}), (bytes / second)(int64_t{1'000'000}), T0};
+    ASSERT_TRUE(bucket.try_acquire(bytes(int64_t{1'000}), T0));
+
+    // Taking a negative number of tokens must not give us more.
+    EXPECT_FALSE(bucket.try_acquire(bytes(int64_t{-1'000}), T0));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(int64_t{500})));
+    EXPECT_FALSE(bucket.try_acquire(bytes(int64_t{501}), T0));
+}
+
+TEST(TokenBucket, CapacityAboveMaxCapacityIsReducedToMaxCapacity) {
+    // Nanobytes in an `int64_t` tick count limit us to about 9.2 GB.
+    EXPECT_THAT(ByteBucket::max_capacity(), SameTypeAndValue(bytes(uint64_t{9'223'372'036})));
+
+    ByteBucket bucket{giga(bytes)(uint64_t{20}), (mega(bytes) / second)(uint64_t{1}), T0};
+    EXPECT_THAT(bucket.capacity(), SameTypeAndValue(ByteBucket::max_capacity()));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(ByteBucket::max_capacity()));
+
+    EXPECT_TRUE(bucket.try_acquire(giga(bytes)(uint64_t{9}), T0));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{223'372'036})));
+    EXPECT_THAT(bucket.available(T0 + std::chrono::seconds{1'000}),
+                SameTypeAndValue(bytes(uint64_t{1'223'372'036})));
+}
+
+TEST(TokenBucket, AcceptsAnyImplicitlyConvertibleUnits) {
+    ByteBucket bucket{kilo(bytes)(uint64_t{2}), (mega(bytes) / second)(uint64_t{1}), T0};
+    EXPECT_THAT(bucket.capacity(), SameTypeAndValue(bytes(uint64_t{2'000})));
+    EXPECT_THAT(bucket.rate(), SameTypeAndValue((bytes / second)(uint64_t{1'000'000})));
+    EXPECT_TRUE(bucket.try_acquire(kilo(bytes)(uint64_t{1}), T0));
+    EXPECT_THAT(bucket.available(T0), SameTypeAndValue(bytes(uint64_t{1'000})));
+}
+
+TEST(TokenBucket, RateFasterThanOneTokenPerTickRoundsCostUp) {
+    // At 3 bytes per nanosecond, one byte costs a third of a tick, which rounds up to a whole tick.
+    ByteBucket bucket{bytes(uint64_t{6}), (giga(bytes) / second)(uint64_t{3}), T0};
+    EXPECT_TRUE(bucket.try_acquire(bytes(uint64_t{3}), T0));
+    EXPECT_TRUE(bucket.try_acquire(bytes(uint64_t{1}), T0));
+    EXPECT_FALSE(bucket.try_acquire(bytes(uint64_t{3}), T0));
+}
+
+TEST(TokenBucket, SupportsClocksWithOtherPeriods) {
+    TokenBucket<QuantityI64<Bits>, UnitQuotientT<Bytes, Seconds>, MillisecondClock> bucket{
+        bits(int64_t{8'000}), (bytes / second)(int64_t{500}), MillisecondClock::time_point{}};
+    const auto t0 = MillisecondClock::time_point{};
+    ASSERT_TRUE(bucket.try_acquire(bits(int64_t{8'000}), t0));
+
+    // 500 bytes per second is 4 bits per millisecond.
+    EXPECT_THAT(bucket.available(t0 + milliseconds{3}), SameTypeAndValue(bits(int64_t{12})));
+}
+
+TEST(TokenBucket, ConcurrentRequestsNeverOverdraw) {
+    ByteBucket bucket{bytes(uint64_t{10'000}), (bytes / second)(uint64_t{1}), T0};
+
+    std::atomic<uint64_t> granted{0u};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1'000; ++j) {
+                if (bucket.try_acquire(bytes(uint64_t{3}), T0)) {
+                    granted.fetch_add(3u, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(granted.load(), 9'999u);
+}
+
+}  // namespace au
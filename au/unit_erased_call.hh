@@ -0,0 +1,154 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "au/quantity.hh"
+#include "au/quantity_span.hh"
+#include "au/stdx/span.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+namespace detail {
+
+// How `unit_erased_call()` treats each kind of argument.
+//
+// `Unit` is the unit the argument contributes to the common unit, or `void` if it has none.
+// `erase<Common>(x)` gives what the kernel receives in its place.
+
+// Anything which isn't a quantity is passed through unchanged.
+template <typename T>
+struct UnitErasure {
+    using Unit = void;
+
+    template <typename Common, typename Arg>
+    static constexpr Arg &&erase(Arg &&x) {
+        return std::forward<Arg>(x);
+    }
+};
+
+// A `Quantity` becomes its value in the common unit.
+template <typename U, typename R>
+struct UnitErasure<Quantity<U, R>> {
+    using Unit = U;
+
+    template <typename Common>
+    static constexpr R erase(const Quantity<U, R> &q) {
+        return q.in(Common{});
+    }
+};
+
+// A span of `Quantity` becomes a span of its rep, referring to the same memory.
+//
+// We can't convert a span's values without copying them, so its unit must already be equivalent to
+// the common unit.
+template <typename Q, typename U, typename R>
+struct QuantitySpanUnitErasure {
+    using Unit = U;
+
+    template <typename Common>
+    static stdx::span<CopyConstT<Q, R>> erase(stdx::span<Q> qs) {
+        static_assert(AreUnitsQuantityEquivalent<U, Common>::value,
+                      "Spans passed to unit_erased_call() must already be in the common unit");
+        static_assert(sizeof(Q) == sizeof(R) && alignof(Q) == alignof(R),
+                      "Internal library error: Quantity layout differs from its Rep");
+        return {reinterpret_cast<CopyConstT<Q, R> *>(qs.data()), qs.size()};
+    }
+};
+template <typename U, typename R>
+struct UnitErasure<stdx::span<Quantity<U, R>>>
+    : QuantitySpanUnitErasure<Quantity<U, R>, U, R> {};
+template <typename U, typename R>
+struct UnitErasure<stdx::span<const Quantity<U, R>>>
+    : QuantitySpanUnitErasure<const Quantity<U, R>, U, R> {};
+
+// The common unit of all the arguments which have units.
+template <typename... Us>
+struct UnitList {};
+template <typename Units, typename... Args>
+struct CommonUnitOfArgsImpl;
+template <typename Units, typename... Args>
+using CommonUnitOfArgsT = typename CommonUnitOfArgsImpl<Units, Args...>::type;
+
+template <typename... Us>
+struct CommonUnitOfArgsImpl<UnitList<Us...>> {
+    static_assert(sizeof...(Us) > 0u, "unit_erased_call() needs at least one Quantity argument");
+    using type = CommonUnitT<Us...>;
+};
+template <typename... Us, typename Arg, typename... Args>
+struct CommonUnitOfArgsImpl<UnitList<Us...>, Arg, Args...>
+    : CommonUnitOfArgsImpl<std::conditional_t<std::is_void<typename UnitErasure<Arg>::Unit>::value,
+                                              UnitList<Us...>,
+                                              UnitList<Us..., typename UnitErasure<Arg>::Unit>>,
+                           Args...> {};
+
+template <typename ResultUnit, typename Kernel, typename... RawArgs>
+constexpr auto call_unit_erased(std::false_type /* returns void */,
+                                Kernel &&kernel,
+                                RawArgs &&...args) {
+    return make_quantity_unless_unitless<ResultUnit>(
+        std::forward<Kernel>(kernel)(std::forward<RawArgs>(args)...));
+}
+
+template <typename ResultUnit, typename Kernel, typename... RawArgs>
+constexpr void call_unit_erased(std::true_type /* returns void */,
+                                Kernel &&kernel,
+                                RawArgs &&...args) {
+    std::forward<Kernel>(kernel)(std::forward<RawArgs>(args)...);
+}
+
+}  // namespace detail
+
+// Call `kernel` on the raw values of `args`, and give its result the right units.
+//
+// This lets a generic algorithm over quantities compile to one copy of machine code per _rep_,
+// rather than one per _unit_: put the arithmetic in `kernel`, which only ever sees raw numbers,
+// and keep the unit-typed function which calls `unit_erased_call()` as a thin shell.
+//
+// First, we find the common unit of every argument which has a unit.  Then we pass each argument
+// to `kernel`, as follows:
+//
+//   - `Quantity<U, R>`: its value in the common unit, as an `R`.  Each of these conversions must be
+//     implicit.
+//   - `stdx::span<Quantity<U, R>>` (or `const Quantity`): a `stdx::span<R>` (or `const R`) over the
+//     same memory.  `U` must already be equivalent to the common unit.
+//   - Anything else: passed through unchanged.
+//
+// We treat the kernel's result as being measured in the common unit, raised to `ResultPower`: so
+// we return a `Quantity` of that unit, or the raw result if `ResultPower` is 0.  (If the kernel
+// returns `void`, so do we.)
+//
+// The kernel must not depend on the units: make it a non-template function, or a function object
+// whose `operator()` is templated only on reps.  A lambda defined inside a unit-templated function
+// won't do, because every instantiation of that function has its own lambda type.
+template <std::intmax_t ResultPower = 1, typename Kernel, typename... Args>
+constexpr auto unit_erased_call(Kernel &&kernel, Args &&...args) {
+    using Common = detail::CommonUnitOfArgsT<detail::UnitList<>, std::decay_t<Args>...>;
+    using RawResult = decltype(std::forward<Kernel>(kernel)(
+        detail::UnitErasure<std::decay_t<Args>>::template erase<Common>(
+            std::forward<Args>(args))...));
+    return detail::call_unit_erased<UnitPowerT<Common, ResultPower>>(
+        std::is_void<RawResult>{},
+        std::forward<Kernel>(kernel),
+        detail::UnitErasure<std::decay_t<Args>>::template erase<Common>(
+            std::forward<Args>(args))...);
+}
+
+}  // namespace au
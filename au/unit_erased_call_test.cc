@@ -0,0 +1,144 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/unit_erased_call.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+namespace {
+
+constexpr int32_t add_raw(int32_t a, int32_t b) { return a + b; }
+
+struct Sum {
+    template <typename T>
+    T operator()(stdx::span<const T> values) const {
+        T total{0};
+        for (const auto &x : values) {
+            total += x;
+        }
+        return total;
+    }
+};
+
+struct SumOfSquares {
+    template <typename T>
+    T operator()(stdx::span<const T> values) const {
+        T total{0};
+        for (const auto &x : values) {
+            total += x * x;
+        }
+        return total;
+    }
+};
+
+struct IndexOfMax {
+    template <typename T>
+    std::size_t operator()(stdx::span<const T> values) const {
+        return static_cast<std::size_t>(std::max_element(values.begin(), values.end()) -
+                                        values.begin());
+    }
+};
+
+struct SortInPlace {
+    template <typename T>
+    void operator()(stdx::span<T> values) const {
+        std::sort(values.begin(), values.end());
+    }
+};
+
+struct Scale {
+    template <typename T>
+    T operator()(T x, int factor) const {
+        return x * factor;
+    }
+};
+
+// A unit-typed shell, of the kind `unit_erased_call()` is designed for.
+template <typename U, typename R>
+Quantity<U, R> total(const std::vector<Quantity<U, R>> &values) {
+    return unit_erased_call(Sum{}, stdx::make_span(values));
+}
+
+}  // namespace
+
+TEST(UnitErasedCall, PassesQuantityValuesInCommonUnit) {
+    constexpr auto result = unit_erased_call(add_raw, feet(1), inches(3));
+    StaticAssertTypeEq<decltype(result), const Quantity<Inches, int32_t>>();
+    EXPECT_THAT(result, SameTypeAndValue(inches(15)));
+}
+
+TEST(UnitErasedCall, PassesSingleQuantityInItsOwnUnit) {
+    EXPECT_THAT(unit_erased_call(Scale{}, meters(3.5), 2), SameTypeAndValue(meters(7.0)));
+}
+
+TEST(UnitErasedCall, PassesNonQuantityArgumentsThrough) {
+    int factor = 3;
+    EXPECT_THAT(unit_erased_call(Scale{}, factor, centi(meters)(4)),
+                SameTypeAndValue(centi(meters)(12)));
+}
+
+TEST(UnitErasedCall, ViewsSpanOfQuantitiesAsSpanOfRep) {
+    const std::vector<Quantity<Meters, double>> lengths{meters(1.5), meters(2.0), meters(0.5)};
+    EXPECT_THAT(unit_erased_call(Sum{}, stdx::make_span(lengths)), SameTypeAndValue(meters(4.0)));
+}
+
+TEST(UnitErasedCall, ResultPowerSetsUnitOfResult) {
+    const std::vector<Quantity<Feet, int32_t>> lengths{feet(1), feet(2)};
+    EXPECT_THAT(unit_erased_call<2>(SumOfSquares{}, stdx::make_span(lengths)),
+                SameTypeAndValue(squared(feet)(5)));
+}
+
+TEST(UnitErasedCall, ResultPowerOfZeroGivesRawResult) {
+    const std::vector<Quantity<Inches, int32_t>> lengths{inches(4), inches(9), inches(2)};
+    EXPECT_THAT(unit_erased_call<0>(IndexOfMax{}, stdx::make_span(lengths)),
+                SameTypeAndValue(std::size_t{1u}));
+}
+
+TEST(UnitErasedCall, KernelCanWriteThroughMutableSpan) {
+    std::vector<Quantity<Meters, int32_t>> lengths{meters(3), meters(1), meters(2)};
+    unit_erased_call(SortInPlace{}, stdx::make_span(lengths));
+    EXPECT_THAT(lengths, ElementsAre(meters(1), meters(2), meters(3)));
+}
+
+TEST(UnitErasedCall, SpanIsUsableAlongsideQuantityInSameUnit) {
+    const std::vector<Quantity<Meters, double>> lengths{meters(1.0), meters(2.0)};
+    const auto sum_plus_offset = [](stdx::span<const double> values, double offset) {
+        return Sum{}(values) + offset;
+    };
+    EXPECT_THAT(unit_erased_call(sum_plus_offset, stdx::make_span(lengths), meters(0.25)),
+                SameTypeAndValue(meters(3.25)));
+}
+
+TEST(UnitErasedCall, SupportsUnitTypedShells) {
+    EXPECT_THAT(total(std::vector<Quantity<Feet, int32_t>>{feet(1), feet(2)}),
+                SameTypeAndValue(feet(3)));
+    EXPECT_THAT(total(std::vector<Quantity<Inches, int32_t>>{inches(1), inches(2)}),
+                SameTypeAndValue(inches(3)));
+}
+
+}  // namespace au
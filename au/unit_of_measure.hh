@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "au/dimension.hh"
 #include "au/magnitude.hh"
 #include "au/power_aliases.hh"
@@ -293,19 +295,115 @@ struct UnitProduct {
     using Mag = MagProductT<detail::MagT<UnitPows>...>;
 };
 
-// Helper to make a canonicalized product of units.
+// Opt-in registry of named units which stand in for products of units.
+//
+// By default, unit arithmetic yields a `UnitProduct<...>` whenever more than one unit remains.  To
+// make a named unit the canonical representative of its product instead, make it inherit from
+// `CanonicalNamedUnitBase` of that product (spelled with `RawUnitProductT`, below), and specialize
+// this trait for the product, right after the unit's definition:
+//
+//     struct MetersPerSecondSquared
+//         : CanonicalNamedUnitBase<RawUnitProductT<Meters, Pow<Seconds, -2>>> { ... };
+//     template <>
+//     struct CanonicalNamedUnit<RawUnitProductT<Meters, Pow<Seconds, -2>>>
+//         : stdx::type_identity<MetersPerSecondSquared> {};
+//
+// Then, any unit arithmetic which yields that product yields `MetersPerSecondSquared` instead, and
+// any which takes `MetersPerSecondSquared` as an input treats it as that product.
+//
+// Every computation of the product must see the specialization, or else the same expression would
+// have different types in different translation units (an ODR violation).  We can't detect every
+// such computation, but we do check every use of the named unit itself.
+template <typename Product>
+struct CanonicalNamedUnit : stdx::type_identity<Product> {};
+
+namespace detail {
+struct CanonicalNamedUnitMarker {};
+
+template <typename U>
+struct IsUnitProduct : std::false_type {};
+template <typename... UnitPows>
+struct IsUnitProduct<UnitProduct<UnitPows...>> : std::true_type {};
+}  // namespace detail
+
+// The base class for a canonical named unit (see `CanonicalNamedUnit`, above).
+template <typename Product>
+struct CanonicalNamedUnitBase : Product, detail::CanonicalNamedUnitMarker {
+    static_assert(detail::IsUnitProduct<Product>::value,
+                  "A canonical named unit must stand in for a product of more than one unit");
+};
+
+namespace detail {
+// The `UnitProduct` which `U` inherits from, if there is exactly one.
+template <typename... Us>
+UnitProduct<Us...> unit_product_base(const UnitProduct<Us...> *);
+template <typename U>
+using UnitProductBase = decltype(detail::unit_product_base(std::declval<const U *>()));
+
+// A registered `CanonicalNamedUnit` becomes its product; every other unit is unchanged.
+//
+// Only units which inherit from a `CanonicalNamedUnitBase` can be registered, so we check for that
+// first: it's much cheaper than looking for a `UnitProduct` base in every unit.
+template <typename U, bool = std::is_base_of<CanonicalNamedUnitMarker, U>::value>
+struct ExpandNamedUnit : stdx::type_identity<U> {};
+template <typename U>
+struct ExpandNamedUnit<U, true>
+    : std::conditional<
+          std::is_same<typename CanonicalNamedUnit<UnitProductBase<U>>::type, U>::value,
+          UnitProductBase<U>,
+          U> {
+    static_assert(!std::is_same<typename CanonicalNamedUnit<UnitProductBase<U>>::type,
+                                UnitProductBase<U>>::value,
+                  "Canonical named unit used where its CanonicalNamedUnit specialization is not "
+                  "visible; specialize it right after the unit's definition");
+};
+template <typename U>
+using ExpandNamedUnitT = typename ExpandNamedUnit<U>::type;
+
+// A `UnitProduct` becomes its registered `CanonicalNamedUnit`, if it has one.
+template <typename Product, typename Named>
+struct CheckedCanonicalNamedUnit : stdx::type_identity<Named> {
+    static_assert(std::is_base_of<Product, Named>::value,
+                  "A CanonicalNamedUnit must inherit from the product it represents");
+    static_assert(AreUnitsQuantityEquivalent<Product, Named>::value,
+                  "A CanonicalNamedUnit must be quantity-equivalent to the product it represents");
+};
+template <typename Product>
+struct CheckedCanonicalNamedUnit<Product, Product> : stdx::type_identity<Product> {};
+
+template <typename U>
+struct SubstituteNamedUnit : stdx::type_identity<U> {};
+template <typename... UnitPows>
+struct SubstituteNamedUnit<UnitProduct<UnitPows...>>
+    : CheckedCanonicalNamedUnit<UnitProduct<UnitPows...>,
+                                typename CanonicalNamedUnit<UnitProduct<UnitPows...>>::type> {};
+template <typename U>
+using SubstituteNamedUnitT = typename SubstituteNamedUnit<U>::type;
+}  // namespace detail
+
+// Helper to make a canonicalized product of units, ignoring the `CanonicalNamedUnit` registry on
+// the output side.
 //
 // On the input side, we treat every input unit as a UnitProduct.  Once we get our final result, we
 // simplify it using `UnpackIfSoloT`.  (The motivation is that we don't want to return, say,
 // `UnitProduct<Meters>`; we'd rather just return `Meters`.)
 template <typename... UnitPows>
-using UnitProductT =
-    UnpackIfSoloT<UnitProduct, PackProductT<UnitProduct, AsPackT<UnitProduct, UnitPows>...>>;
+using RawUnitProductT = UnpackIfSoloT<
+    UnitProduct,
+    PackProductT<UnitProduct, AsPackT<UnitProduct, detail::ExpandNamedUnitT<UnitPows>>...>>;
+
+// Helper to make a canonicalized product of units.
+//
+// This is `RawUnitProductT`, except that we replace any product which has a registered
+// `CanonicalNamedUnit` with that named unit.
+template <typename... UnitPows>
+using UnitProductT = detail::SubstituteNamedUnitT<RawUnitProductT<UnitPows...>>;
 
 // Raise a Unit to a (possibly rational) Power.
 template <typename U, std::intmax_t ExpNum, std::intmax_t ExpDen = 1>
-using UnitPowerT =
-    UnpackIfSoloT<UnitProduct, PackPowerT<UnitProduct, AsPackT<UnitProduct, U>, ExpNum, ExpDen>>;
+using UnitPowerT = detail::SubstituteNamedUnitT<UnpackIfSoloT<
+    UnitProduct,
+    PackPowerT<UnitProduct, AsPackT<UnitProduct, detail::ExpandNamedUnitT<U>>, ExpNum, ExpDen>>>;
 
 // Compute the inverse of a unit.
 template <typename U>
@@ -85,6 +85,18 @@ struct AssociatedUnit<SomeUnitWrapper<UnitT>> : stdx::type_identity<UnitT> {};
 
 struct UnlabeledUnit : decltype(Feet{} * mag<9>()) {};
 
+// A named unit which registers itself as the canonical representative of its product.
+struct YardsPerMinuteSquared : CanonicalNamedUnitBase<RawUnitProductT<Yards, Pow<Minutes, -2>>> {
+    static constexpr const char label[] = "yd/min^2";
+};
+constexpr const char YardsPerMinuteSquared::label[];
+template <>
+struct CanonicalNamedUnit<RawUnitProductT<Yards, Pow<Minutes, -2>>>
+    : stdx::type_identity<YardsPerMinuteSquared> {};
+
+// A unit which inherits from a registered unit, but isn't registered itself.
+struct UnregisteredAcceleration : YardsPerMinuteSquared {};
+
 MATCHER_P(QuantityEquivalentToUnit, target, "") {
     return are_units_quantity_equivalent(arg, target);
 }
@@ -205,6 +217,49 @@ TEST(UnitQuotientT, InteractsAndCancelsAsExpected) {
     StaticAssertTypeEq<UnitProductT<UnitQuotientT<Feet, Minutes>, Minutes>, Feet>();
 }
 
+TEST(CanonicalNamedUnit, ArithmeticYieldsRegisteredNamedUnitForItsProduct) {
+    StaticAssertTypeEq<decltype(Yards{} / squared(Minutes{})), YardsPerMinuteSquared>();
+    StaticAssertTypeEq<decltype(Yards{} / (Minutes{} * Minutes{})), YardsPerMinuteSquared>();
+    StaticAssertTypeEq<UnitQuotientT<UnitQuotientT<Yards, Minutes>, Minutes>,
+                       YardsPerMinuteSquared>();
+}
+
+TEST(CanonicalNamedUnit, RegisteredNamedUnitActsAsItsProductInArithmetic) {
+    StaticAssertTypeEq<decltype(YardsPerMinuteSquared{} * Minutes{}),
+                       decltype(Yards{} / Minutes{})>();
+    StaticAssertTypeEq<decltype(YardsPerMinuteSquared{} * squared(Minutes{})), Yards>();
+    StaticAssertTypeEq<decltype(YardsPerMinuteSquared{} / YardsPerMinuteSquared{}),
+                       UnitProduct<>>();
+    StaticAssertTypeEq<UnitPowerT<YardsPerMinuteSquared, 2>,
+                       RawUnitProductT<Pow<Yards, 2>, Pow<Minutes, -4>>>();
+}
+
+TEST(CanonicalNamedUnit, PowersWhichRoundTripGiveBackRegisteredNamedUnit) {
+    StaticAssertTypeEq<UnitPowerT<YardsPerMinuteSquared, 1>, YardsPerMinuteSquared>();
+    StaticAssertTypeEq<UnitInverseT<UnitInverseT<YardsPerMinuteSquared>>,
+                       YardsPerMinuteSquared>();
+    StaticAssertTypeEq<decltype(root<2>(squared(YardsPerMinuteSquared{}))),
+                       YardsPerMinuteSquared>();
+}
+
+TEST(CanonicalNamedUnit, ArithmeticResultUsesLabelOfRegisteredNamedUnit) {
+    EXPECT_THAT(unit_label(Yards{} / squared(Minutes{})), StrEq("yd/min^2"));
+}
+
+TEST(CanonicalNamedUnit, UnitsDerivedFromRegisteredNamedUnitStayOpaque) {
+    StaticAssertTypeEq<decltype(UnregisteredAcceleration{} * Minutes{}),
+                       RawUnitProductT<UnregisteredAcceleration, Minutes>>();
+    EXPECT_THAT(UnregisteredAcceleration{} * Minutes{},
+                QuantityEquivalentToUnit(Yards{} / Minutes{}));
+}
+
+TEST(CanonicalNamedUnit, LeavesUnregisteredProductsAlone) {
+    StaticAssertTypeEq<UnitProductT<Feet, Pow<Minutes, -2>>,
+                       RawUnitProductT<Feet, Pow<Minutes, -2>>>();
+    StaticAssertTypeEq<decltype(Feet{} / squared(Minutes{})),
+                       RawUnitProductT<Feet, Pow<Minutes, -2>>>();
+}
+
 TEST(UnitInverseT, CreatesAppropriateUnitPower) {
     StaticAssertTypeEq<UnitInverseT<Feet>, Pow<Feet, -1>>();
     StaticAssertTypeEq<UnitInverseT<UnitInverseT<Minutes>>, Minutes>();
@@ -0,0 +1,38 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/quantity.hh"
+#include "au/units/revolutions.hh"
+
+namespace au {
+
+// A binary angular measurement (BAM) unit: one revolution is 2^16 counts.  Storing it in a
+// `uint16_t` makes an angle which wraps around naturally, once per revolution.
+//
+// DO NOT follow this pattern to define your own units.  This is for library-defined units.
+// Instead, follow instructions at (https://aurora-opensource.github.io/au/main/howto/new-units/).
+template <typename T>
+struct Bam16Label {
+    static constexpr const char label[] = "bam16";
+};
+template <typename T>
+constexpr const char Bam16Label<T>::label[];
+struct Bam16 : decltype(Revolutions{} / pow<16>(mag<2>())), Bam16Label<void> {
+    using Bam16Label<void>::label;
+};
+constexpr auto bam16 = QuantityMaker<Bam16>{};
+
+}  // namespace au
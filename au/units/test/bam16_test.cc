@@ -0,0 +1,43 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/units/bam16.hh"
+
+#include <cstdint>
+
+#include "au/testing.hh"
+#include "au/units/radians.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(Bam16, HasExpectedLabel) { expect_label<Bam16>("bam16"); }
+
+TEST(Bam16, OneRevolutionIsTwoToThe16) {
+    EXPECT_EQ(bam16(std::int64_t{65'536}), revolutions(std::int64_t{1}));
+}
+
+TEST(Bam16, EighthOfRevolutionIs45Degrees) {
+    EXPECT_EQ(bam16(std::int64_t{8'192}), degrees(std::int64_t{45}));
+}
+
+TEST(Bam16, ConvertsExactlyToFloatingPointDegrees) {
+    EXPECT_EQ(bam16(1.0).in(degrees), 360.0 / 65'536.0);
+}
+
+TEST(Bam16, HalfRevolutionIsPiRadians) {
+    EXPECT_DOUBLE_EQ(bam16(32'768.0).in(radians), 3.14159265358979323846);
+}
+
+}  // namespace au
@@ -0,0 +1,43 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/units/bam32.hh"
+
+#include <cstdint>
+
+#include "au/testing.hh"
+#include "au/units/radians.hh"
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(Bam32, HasExpectedLabel) { expect_label<Bam32>("bam32"); }
+
+TEST(Bam32, OneRevolutionIsTwoToThe32) {
+    EXPECT_EQ(bam32(std::int64_t{4'294'967'296}), revolutions(std::int64_t{1}));
+}
+
+TEST(Bam32, EighthOfRevolutionIs45Degrees) {
+    EXPECT_EQ(bam32(std::int64_t{536'870'912}), degrees(std::int64_t{45}));
+}
+
+TEST(Bam32, ConvertsExactlyToFloatingPointDegrees) {
+    EXPECT_EQ(bam32(1.0).in(degrees), 360.0 / 4'294'967'296.0);
+}
+
+TEST(Bam32, HalfRevolutionIsPiRadians) {
+    EXPECT_DOUBLE_EQ(bam32(2'147'483'648.0).in(radians), 3.14159265358979323846);
+}
+
+}  // namespace au
@@ -0,0 +1,185 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+
+namespace au {
+
+namespace detail {
+
+// Arithmetic modulo `Modulus`, on values of the unsigned type `R` which lie in `[0, Modulus)`.
+//
+// A `Modulus` of 0 stands for `2^N`, where `N` is the number of bits in `R`: that is, the natural
+// wraparound of `R` itself.  We never compute any intermediate result outside of `[0, Modulus)`, so
+// every operation is exact, and needs only integer arithmetic.
+template <typename R, std::uintmax_t Modulus>
+struct ModularArithmetic {
+    static_assert(Modulus != 1u, "A period of 1 would leave only a single value");
+    static_assert(Modulus == 0u || Modulus - 1u <= std::numeric_limits<R>::max(),
+                  "Modulus is too large to store its values in the rep");
+
+    using Signed = std::make_signed_t<R>;
+
+    // The largest value, `Modulus - 1`.
+    static constexpr R max_value() {
+        return (Modulus == 0u) ? std::numeric_limits<R>::max() : static_cast<R>(Modulus - 1u);
+    }
+
+    // `Modulus - x`, for `0 < x < Modulus`.
+    static constexpr R complement(R x) { return static_cast<R>(max_value() - x + 1u); }
+
+    static constexpr R reduce(R x) {
+        return (Modulus == 0u) ? x : static_cast<R>(x % static_cast<R>(Modulus));
+    }
+
+    // The value congruent to `x`.  For negative `x`, we reduce `-(x + 1)`, which can't overflow.
+    static constexpr R reduce_signed(Signed x) {
+        return (x >= 0) ? reduce(static_cast<R>(x))
+                        : static_cast<R>(max_value() - reduce(static_cast<R>(-(x + 1))));
+    }
+
+    static constexpr R add(R a, R b) {
+        return (b != 0u && a >= complement(b)) ? static_cast<R>(a - complement(b))
+                                                : static_cast<R>(a + b);
+    }
+
+    static constexpr R sub(R a, R b) {
+        return (a >= b) ? static_cast<R>(a - b) : static_cast<R>(a + complement(b));
+    }
+
+    // The shortest signed distance from `b` to `a`.  It lies in `[-Modulus / 2, Modulus / 2)`:
+    // when the points are exactly half a period apart, the distance is negative either way.
+    static constexpr Signed distance(R a, R b) {
+        const R forward = sub(a, b);
+        if (forward == 0u || forward < complement(forward)) {
+            return static_cast<Signed>(forward);
+        }
+
+        // `-complement(forward)`, computed so that it can't overflow when it's the lowest `Signed`.
+        return static_cast<Signed>(-static_cast<Signed>(complement(forward) - 1u) - 1);
+    }
+};
+
+}  // namespace detail
+
+// `WrappingQuantityPoint<U, R, Modulus>`: a point which wraps around once per period, such as
+// a hardware tick counter, an RTP timestamp, a sequence number, or a heading.
+//
+// `R` must be an unsigned integral type, and the stored value lies in `[0, Modulus)`, in units of
+// `U`.  The default `Modulus` of 0 means "the full range of `R`": for example, a 32-bit counter
+// which wraps from `2^32 - 1` to 0.
+//
+// The difference of two points is the _shortest_ signed `Quantity` between them, modulo the period,
+// and comparisons follow serial number arithmetic (RFC 1982): `a < b` when `b` is less than half
+// a period ahead of `a`.  When two points are exactly half a period apart, neither is less than the
+// other.  All arithmetic is done in integers.
+template <typename UnitT, typename RepT, std::uintmax_t Modulus = 0u>
+class WrappingQuantityPoint {
+    static_assert(std::is_integral<RepT>::value && std::is_unsigned<RepT>::value,
+                  "WrappingQuantityPoint requires an unsigned integral Rep");
+    static_assert(!std::is_same<RepT, bool>::value, "WrappingQuantityPoint cannot use bool Rep");
+
+    using Arithmetic = detail::ModularArithmetic<RepT, Modulus>;
+
+ public:
+    using Rep = RepT;
+    using Unit = UnitT;
+    using Diff = Quantity<Unit, std::make_signed_t<Rep>>;
+
+    // The point at the value 0.
+    constexpr WrappingQuantityPoint() noexcept = default;
+
+    // The point congruent to `p`, modulo the period.
+    constexpr explicit WrappingQuantityPoint(QuantityPoint<Unit, Rep> p) noexcept
+        : value_{Arithmetic::reduce(p.in(Unit{}))} {}
+
+    // The stored value, which lies in `[0, Modulus)`.
+    template <typename U>
+    constexpr Rep in(U) const {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnitT<U>, Unit>::value,
+                      "Can only get the value of a WrappingQuantityPoint in its own unit");
+        return value_;
+    }
+
+    // The stored value, as a `QuantityPoint`.
+    constexpr QuantityPoint<Unit, Rep> as_quantity_point() const {
+        return make_quantity_point<Unit>(value_);
+    }
+
+    // The shortest signed distance from `b` to `a`, modulo the period.
+    friend constexpr Diff operator-(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return make_quantity<Unit>(Arithmetic::distance(a.value_, b.value_));
+    }
+
+    // Moving a point by a (possibly negative) displacement.
+    friend constexpr WrappingQuantityPoint operator+(WrappingQuantityPoint p, Diff d) {
+        return {FromReducedValue{},
+                Arithmetic::add(p.value_, Arithmetic::reduce_signed(d.in(Unit{})))};
+    }
+    friend constexpr WrappingQuantityPoint operator+(Diff d, WrappingQuantityPoint p) {
+        return p + d;
+    }
+    friend constexpr WrappingQuantityPoint operator-(WrappingQuantityPoint p, Diff d) {
+        return {FromReducedValue{},
+                Arithmetic::sub(p.value_, Arithmetic::reduce_signed(d.in(Unit{})))};
+    }
+    friend constexpr WrappingQuantityPoint &operator+=(WrappingQuantityPoint &p, Diff d) {
+        return p = p + d;
+    }
+    friend constexpr WrappingQuantityPoint &operator-=(WrappingQuantityPoint &p, Diff d) {
+        return p = p - d;
+    }
+
+    // Serial number comparisons (RFC 1982).
+    friend constexpr bool operator==(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return a.value_ == b.value_;
+    }
+    friend constexpr bool operator!=(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return a.value_ != b.value_;
+    }
+    friend constexpr bool operator<(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return Arithmetic::distance(b.value_, a.value_) > 0;
+    }
+    friend constexpr bool operator>(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return b < a;
+    }
+    friend constexpr bool operator<=(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return a == b || a < b;
+    }
+    friend constexpr bool operator>=(WrappingQuantityPoint a, WrappingQuantityPoint b) {
+        return a == b || b < a;
+    }
+
+ private:
+    struct FromReducedValue {};
+    constexpr WrappingQuantityPoint(FromReducedValue, Rep reduced_value) noexcept
+        : value_{reduced_value} {}
+
+    Rep value_{0};
+};
+
+// Make a `WrappingQuantityPoint` with the (optional) period `Modulus`, from a `QuantityPoint`.
+template <std::uintmax_t Modulus = 0u, typename U, typename R>
+constexpr WrappingQuantityPoint<U, R, Modulus> make_wrapping_quantity_point(QuantityPoint<U, R> p) {
+    return WrappingQuantityPoint<U, R, Modulus>{p};
+}
+
+}  // namespace au
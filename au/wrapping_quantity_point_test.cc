@@ -0,0 +1,150 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/wrapping_quantity_point.hh"
+
+#include <cstdint>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/degrees.hh"
+#include "au/units/seconds.hh"
+#include "gtest/gtest.h"
+
+using ::testing::StaticAssertTypeEq;
+
+namespace au {
+namespace {
+
+// A 32-bit millisecond tick counter, which wraps around at `2^32`.
+using Ticks = WrappingQuantityPoint<Milli<Seconds>, std::uint32_t>;
+
+// A heading in hundredths of a degree, which wraps around once per revolution.
+using Heading = WrappingQuantityPoint<Centi<Degrees>, std::uint16_t, 36'000u>;
+
+// A point on a small, odd period.
+using Weekday = WrappingQuantityPoint<Seconds, std::uint8_t, 7u>;
+
+constexpr Ticks ticks_at(std::uint32_t value) {
+    return Ticks{make_quantity_point<Milli<Seconds>>(value)};
+}
+
+constexpr Heading heading_at(std::uint16_t value) {
+    return Heading{make_quantity_point<Centi<Degrees>>(value)};
+}
+
+constexpr Weekday weekday_at(std::uint8_t value) {
+    return Weekday{make_quantity_point<Seconds>(value)};
+}
+
+}  // namespace
+
+TEST(WrappingQuantityPoint, DefaultConstructsToZero) {
+    EXPECT_EQ(Ticks{}.in(milli(seconds)), 0u);
+    EXPECT_EQ(Heading{}, heading_at(0u));
+}
+
+TEST(WrappingQuantityPoint, ConstructionReducesModuloPeriod) {
+    EXPECT_EQ(heading_at(36'005u).in(centi(degrees)), 5u);
+    EXPECT_EQ(heading_at(35'999u).in(centi(degrees)), 35'999u);
+    EXPECT_EQ(weekday_at(255u).in(seconds), 3u);
+}
+
+TEST(WrappingQuantityPoint, AsQuantityPointGivesStoredValue) {
+    EXPECT_EQ(heading_at(36'100u).as_quantity_point(),
+              make_quantity_point<Centi<Degrees>>(std::uint16_t{100}));
+}
+
+TEST(WrappingQuantityPoint, MakeWrappingQuantityPointDeducesUnitAndRep) {
+    constexpr auto origin = make_quantity_point<Centi<Degrees>>(std::uint16_t{0});
+    constexpr auto p = make_wrapping_quantity_point<36'000u>(origin);
+    StaticAssertTypeEq<decltype(p), const Heading>();
+}
+
+TEST(WrappingQuantityPoint, DifferenceIsShortestSignedDistanceAcrossWraparound) {
+    const auto before = ticks_at(0xFFFF'FFF0u);
+    const auto after = ticks_at(0x10u);
+    StaticAssertTypeEq<decltype(after - before), Quantity<Milli<Seconds>, std::int32_t>>();
+    EXPECT_EQ(after - before, milli(seconds)(32));
+    EXPECT_EQ(before - after, milli(seconds)(-32));
+}
+
+TEST(WrappingQuantityPoint, DifferenceUsesCustomPeriod) {
+    EXPECT_EQ(heading_at(100u) - heading_at(35'900u), centi(degrees)(std::int16_t{200}));
+    EXPECT_EQ(heading_at(35'900u) - heading_at(100u), centi(degrees)(std::int16_t{-200}));
+    EXPECT_EQ(weekday_at(3u) - weekday_at(0u), seconds(std::int8_t{3}));
+    EXPECT_EQ(weekday_at(4u) - weekday_at(0u), seconds(std::int8_t{-3}));
+}
+
+TEST(WrappingQuantityPoint, DifferenceOfHalfPeriodIsNegativeEitherWay) {
+    EXPECT_EQ(ticks_at(0x8000'0000u) - ticks_at(0u), milli(seconds)(INT32_MIN));
+    EXPECT_EQ(ticks_at(0u) - ticks_at(0x8000'0000u), milli(seconds)(INT32_MIN));
+    EXPECT_EQ(heading_at(18'000u) - heading_at(0u), centi(degrees)(std::int16_t{-18'000}));
+}
+
+TEST(WrappingQuantityPoint, AddingDisplacementWrapsAround) {
+    EXPECT_EQ(ticks_at(0xFFFF'FFF0u) + milli(seconds)(32), ticks_at(0x10u));
+    EXPECT_EQ(milli(seconds)(-32) + ticks_at(0x10u), ticks_at(0xFFFF'FFF0u));
+    EXPECT_EQ(ticks_at(0x10u) - milli(seconds)(32), ticks_at(0xFFFF'FFF0u));
+
+    EXPECT_EQ(heading_at(35'900u) + centi(degrees)(std::int16_t{200}), heading_at(100u));
+    EXPECT_EQ(heading_at(100u) + centi(degrees)(std::int16_t{-300}), heading_at(35'800u));
+    EXPECT_EQ(heading_at(100u) - centi(degrees)(std::int16_t{32'000}), heading_at(4'100u));
+}
+
+TEST(WrappingQuantityPoint, AddingLowestDisplacementDoesNotOverflow) {
+    // -128 is congruent to 5, modulo 7.
+    EXPECT_EQ(weekday_at(0u) + seconds(std::int8_t{-128}), weekday_at(5u));
+    EXPECT_EQ(weekday_at(0u) - seconds(std::int8_t{-128}), weekday_at(2u));
+}
+
+TEST(WrappingQuantityPoint, CompoundAssignmentMovesPoint) {
+    auto t = ticks_at(0xFFFF'FFFFu);
+    t += milli(seconds)(2);
+    EXPECT_EQ(t, ticks_at(1u));
+    t -= milli(seconds)(3);
+    EXPECT_EQ(t, ticks_at(0xFFFF'FFFEu));
+}
+
+TEST(WrappingQuantityPoint, ComparesAsSerialNumbers) {
+    const auto before = ticks_at(0xFFFF'FFF0u);
+    const auto after = ticks_at(0x10u);
+    EXPECT_LT(before, after);
+    EXPECT_LE(before, after);
+    EXPECT_GT(after, before);
+    EXPECT_GE(after, before);
+    EXPECT_FALSE(after < before);
+    EXPECT_LE(after, after);
+    EXPECT_GE(after, after);
+    EXPECT_NE(before, after);
+}
+
+TEST(WrappingQuantityPoint, PointsHalfPeriodApartAreUnordered) {
+    const auto a = heading_at(0u);
+    const auto b = heading_at(18'000u);
+    EXPECT_FALSE(a < b);
+    EXPECT_FALSE(b < a);
+    EXPECT_FALSE(a <= b);
+    EXPECT_FALSE(a >= b);
+    EXPECT_NE(a, b);
+}
+
+TEST(WrappingQuantityPoint, SupportsConstexpr) {
+    constexpr auto t = ticks_at(0xFFFF'FFFFu) + milli(seconds)(1);
+    static_assert(t == ticks_at(0u), "");
+    static_assert(ticks_at(1u) > t, "");
+    static_assert((ticks_at(1u) - t) == milli(seconds)(1), "");
+}
+
+}  // namespace au
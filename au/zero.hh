@@ -14,11 +14,23 @@
 
 #pragma once
 
-#include <chrono>
 #include <type_traits>
 
+#include "au/stdx/type_traits.hh"
+
 namespace au {
 
+namespace detail {
+template <typename T, typename = void>
+struct IsDurationLike : std::false_type {};
+
+// A type "looks like" a `std::chrono::duration` if it has the same member types, and can be built
+// from its `rep`.  We check this structurally, so that we don't need to include `<chrono>`.
+template <typename T>
+struct IsDurationLike<T, stdx::void_t<typename T::rep, typename T::period>>
+    : std::is_constructible<T, typename T::rep> {};
+}  // namespace detail
+
 // A type representing a quantity of "zero" in any units.
 //
 // Zero is special: it's the only number that we can meaningfully compare or assign to a Quantity of
@@ -38,10 +50,10 @@ struct Zero {
         return 0;
     }
 
-    // Implicit conversion to chrono durations.
-    template <typename Rep, typename Period>
-    constexpr operator std::chrono::duration<Rep, Period>() const {
-        return std::chrono::duration<Rep, Period>{0};
+    // Implicit conversion to chrono durations (or any type shaped like one).
+    template <typename T, std::enable_if_t<detail::IsDurationLike<T>::value, int> = 0>
+    constexpr operator T() const {
+        return T{typename T::rep{0}};
     }
 };
 
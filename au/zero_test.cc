@@ -14,6 +14,8 @@
 
 #include "au/zero.hh"
 
+#include <chrono>
+
 #include "gtest/gtest.h"
 
 using namespace std::chrono_literals;
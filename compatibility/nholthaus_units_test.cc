@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <vector>
+
 #include "au/au.hh"
 #include "au/testing.hh"
 #include "au/units/bars.hh"
@@ -161,4 +163,29 @@ TEST(FootPounds, EquivalentWithinAFewPartsPerBillion) {
     EXPECT_EQ(round_trip, original);
 }
 
+TEST(NholthausRanges, CanBulkConvertToCorrespondingQuantity) {
+    const std::vector<::units::time::millisecond_t> durations{::units::time::millisecond_t{3.0},
+                                                              ::units::time::millisecond_t{4.5}};
+
+    std::vector<QuantityD<Milli<Seconds>>> as_au(durations.size());
+    convert_quantities(stdx::make_span(durations), stdx::make_span(as_au));
+    EXPECT_THAT(as_au[0], SameTypeAndValue(milli(seconds)(3.0)));
+    EXPECT_THAT(as_au[1], SameTypeAndValue(milli(seconds)(4.5)));
+}
+
+TEST(NholthausRanges, CanBulkConvertWhenUnitsDiffer) {
+    const std::vector<::units::length::meter_t> lengths{::units::length::meter_t{1'500.0},
+                                                        ::units::length::meter_t{250.0}};
+
+    std::vector<QuantityD<Kilo<Meters>>> as_au(lengths.size());
+    convert_quantities(stdx::make_span(lengths), stdx::make_span(as_au));
+    EXPECT_THAT(as_au[0], IsNear(kilo(meters)(1.5), kilo(meters)(1e-12)));
+    EXPECT_THAT(as_au[1], IsNear(kilo(meters)(0.25), kilo(meters)(1e-12)));
+
+    std::vector<::units::length::millimeter_t> back(as_au.size());
+    convert_quantities(stdx::make_span(as_au), stdx::make_span(back));
+    EXPECT_EQ(back[0], ::units::length::millimeter_t{1'500'000.0});
+    EXPECT_EQ(back[1], ::units::length::millimeter_t{250'000.0});
+}
+
 }  // namespace
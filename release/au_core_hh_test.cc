@@ -0,0 +1,48 @@
+// Copyright 2023 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "docs/au_core.hh"
+
+// The whole point of this file is that it leaves out these headers, so check that before including
+// anything else (see `au/core_test.cc`).
+#if defined(__GLIBCXX__)
+#if defined(_GLIBCXX_CHRONO) || defined(_GLIBCXX_CMATH) || defined(_GLIBCXX_FUNCTIONAL) || \
+    defined(_GLIBCXX_OSTREAM)
+#error "au_core.hh must not include <chrono>, <cmath>, <functional>, or <ostream>"
+#endif
+#endif
+
+#include "gtest/gtest.h"
+
+namespace au {
+
+TEST(CoreSingleFile, HasExpectedUnits) {
+    EXPECT_EQ(meters(1.23).in(meters), 1.23);
+    EXPECT_EQ(seconds(1.23).in(seconds), 1.23);
+    EXPECT_EQ(kilo(grams)(1.23).in(kilo(grams)), 1.23);
+    EXPECT_EQ(kelvins(1.23).in(kelvins), 1.23);
+    EXPECT_EQ(amperes(1.23).in(amperes), 1.23);
+    EXPECT_EQ(moles(1.23).in(moles), 1.23);
+    EXPECT_EQ(candelas(1.23).in(candelas), 1.23);
+    EXPECT_EQ(radians(1.23).in(radians), 1.23);
+    EXPECT_EQ(bits(1.23).in(bits), 1.23);
+    EXPECT_EQ(unos(1.23).in(unos), 1.23);
+}
+
+TEST(CoreSingleFile, SupportsPrefixes) {
+    EXPECT_EQ(kibi(bits)(1), bits(1024));
+    EXPECT_EQ(centi(meters)(100), meters(1));
+}
+
+}  // namespace au